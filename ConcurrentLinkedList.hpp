@@ -0,0 +1,294 @@
+#pragma once
+/**
+ * @file ConcurrentLinkedList.hpp
+ * @class ConcurrentLinkedList
+ * @brief 一个基于模板的无锁有序单向链表(Harris-Michael算法)
+ *
+ * 节点结构与LinkedList相同：数据加一个_next指针
+ * 不同的是_next是原子的，并借用最低位作为"已删除"标记
+ * 删除分两步：先给节点的_next打标记(逻辑删除)，再把它从前驱上摘下(物理删除)
+ * 遍历时遇到已标记的节点会顺手把它摘下
+ * 摘下的节点交给EpochReclaimer延迟释放，而不是像LinkedList那样立即delete
+ *
+ * 元素按operator<升序存放且不重复，即一个无锁的有序集合
+ * insert() erase() contains() pop_front() 可以被任意多个线程同时调用
+ * 构造、析构、size()之外的其他用法见各函数说明
+ *
+ * @author neOzkyol
+ * @date 2026-01-17
+ * @version 1.0
+ */
+#include <atomic> ///< std::atomic
+#include <cstdint> ///< std::uintptr_t
+#include <utility> ///< std::move
+#include "EpochReclaimer.hpp"
+template<typename DataType> ///< 链表存储的数据类型，需要operator<
+class ConcurrentLinkedList {
+private:
+        struct Node { ///< 链表节点
+                DataType _data; ///< 每个节点的数据
+                std::atomic<std::uintptr_t> _next; ///< 指向下一个节点的指针，最低位为删除标记
+                Node(const DataType& data): _data(data), _next(0){}
+                Node(DataType&& data): _data(std::move(data)), _next(0){}
+        };
+        std::atomic<std::uintptr_t> _head; ///< 链表头结点，不带标记
+        std::atomic<int> _length; ///< 链表的长度，并发修改时是近似值
+        /**
+         * @name 标记位操作
+         * @{
+         */
+        static bool marked(std::uintptr_t link) noexcept {
+                return (link & 1) != 0;
+        }
+        static Node* pointer(std::uintptr_t link) noexcept {
+                return reinterpret_cast<Node*>(link & ~static_cast<std::uintptr_t>(1));
+        }
+        static std::uintptr_t link(Node* node, bool mark = false) noexcept {
+                return reinterpret_cast<std::uintptr_t>(node) | (mark? 1: 0);
+        }
+        /** @} */
+        /**
+         * @brief 交给EpochReclaimer的释放函数
+         *
+         * @param node 要释放的节点
+         */
+        static void deleteNode(void* node) {
+                delete static_cast<Node*>(node);
+        }
+        /**
+         * @brief find()的结果
+         *
+         * prev是前驱的_next(或_head)，curr是第一个不小于目标的节点，next是curr的后继
+         *
+         */
+        struct Position {
+                std::atomic<std::uintptr_t>* _prev;
+                Node* _curr;
+                Node* _next;
+        };
+        /**
+         * @brief 寻找第一个不小于data的节点
+         *
+         * 链表内部自用函数，调用者必须持有EpochReclaimer::Guard
+         * 顺手摘下并retire()途中遇到的已标记节点
+         * 摘下失败(前驱被修改)时从头重来
+         *
+         * @param data 目标值
+         * @param pos 返回找到的位置
+         * @return 是否找到等于data的节点
+         * @note 时间：O(n), 空间：O(1)，无锁
+         */
+        bool find(const DataType& data, Position& pos) {
+        retry:
+                pos._prev = &_head;
+                pos._curr = pointer(pos._prev -> load(std::memory_order_acquire));
+                while(true) {
+                        if(pos._curr == nullptr) {
+                                return false;
+                        }
+                        std::uintptr_t next = pos._curr -> _next.load(std::memory_order_acquire);
+                        pos._next = pointer(next);
+                        if(marked(next)) {
+                                std::uintptr_t expected = link(pos._curr);
+                                if(!pos._prev -> compare_exchange_strong(expected, link(pos._next))) {
+                                        goto retry;
+                                }
+                                EpochReclaimer::retire(pos._curr, deleteNode);
+                                pos._curr = pos._next;
+                                continue;
+                        }
+                        if(!(pos._curr -> _data < data)) {
+                                return !(data < pos._curr -> _data);
+                        }
+                        pos._prev = &pos._curr -> _next;
+                        pos._curr = pos._next;
+                }
+        }
+        /**
+         * @brief 标记并摘下pos处的节点
+         *
+         * 链表内部自用函数，调用者必须持有EpochReclaimer::Guard
+         * 标记失败(被其他线程抢先修改)时返回false，调用者需要重新find()
+         * 标记成功后摘下失败，则交给find()去摘下
+         *
+         * @param pos find()得到的位置
+         * @return 是否由本线程完成了逻辑删除
+         */
+        bool unlink(Position& pos) {
+                std::uintptr_t expected = link(pos._next);
+                if(!pos._curr -> _next.compare_exchange_strong(expected, link(pos._next, true))) {
+                        return false;
+                }
+                _length.fetch_sub(1, std::memory_order_relaxed);
+                expected = link(pos._curr);
+                if(pos._prev -> compare_exchange_strong(expected, link(pos._next))) {
+                        EpochReclaimer::retire(pos._curr, deleteNode);
+                } else {
+                        Position cleanup;
+                        find(pos._curr -> _data, cleanup);
+                }
+                return true;
+        }
+public:
+        /**
+         * @brief 无参构造函数
+         *
+         * _head初始化为 nullptr
+         * _length初始化为 0
+         *
+         */
+        ConcurrentLinkedList() noexcept: _head(0), _length(0){}
+        ConcurrentLinkedList(const ConcurrentLinkedList&) = delete;
+        ConcurrentLinkedList& operator=(const ConcurrentLinkedList&) = delete;
+        /**
+         * @brief 析构函数
+         *
+         * 调用时不能再有其他线程访问此链表
+         * 仍在链表上的节点(包括已标记未摘下的)直接delete
+         * 已摘下的节点由EpochReclaimer负责
+         *
+         * @note 时间：O(n), 空间：O(1)
+         */
+        ~ConcurrentLinkedList() {
+                Node* curr = pointer(_head.load());
+                while(curr != nullptr) {
+                        Node* next = pointer(curr -> _next.load());
+                        delete curr;
+                        curr = next;
+                }
+        }
+        /**
+         * @brief 获取链表长度
+         *
+         * 有其他线程同时修改时只是一个近似值
+         *
+         * @return _length成员
+         */
+        int size() const noexcept {
+                return _length.load(std::memory_order_relaxed);
+        }
+        /**
+         * @brief 链表是否为空
+         *
+         * 有其他线程同时修改时只是一个瞬间的快照
+         *
+         * @retval true 链表为空
+         * @retval false 反之
+         */
+        bool empty() const noexcept {
+                return pointer(_head.load()) == nullptr;
+        }
+        /**
+         * @name 插入
+         * @brief 按顺序插入一个元素
+         *
+         * 已有相等的元素时不插入
+         * 分为拷贝和移动两个版本
+         *
+         * @param data 要插入的数据
+         * @retval true 插入成功
+         * @retval false 已存在
+         * @note 时间：O(n), 空间：O(1)，无锁
+         * @{
+         */
+        bool insert(const DataType& data) {
+                return insertNode(new Node(data));
+        }
+        bool insert(DataType&& data) {
+                return insertNode(new Node(std::move(data)));
+        }
+        /** @} */
+        /**
+         * @brief 删除等于data的元素
+         *
+         * @param data 要删除的数据
+         * @retval true 删除成功
+         * @retval false 不存在
+         * @note 时间：O(n), 空间：O(1)，无锁
+         */
+        bool erase(const DataType& data) {
+                EpochReclaimer::Guard guard;
+                Position pos;
+                while(find(data, pos)) {
+                        if(unlink(pos)) {
+                                return true;
+                        }
+                }
+                return false;
+        }
+        /**
+         * @brief 是否含有等于data的元素
+         *
+         * @param data 要寻找的数据
+         * @retval true 存在
+         * @retval false 不存在
+         * @note 时间：O(n), 空间：O(1)，无锁
+         */
+        bool contains(const DataType& data) {
+                EpochReclaimer::Guard guard;
+                Position pos;
+                return find(data, pos);
+        }
+        /**
+         * @brief 头删除
+         *
+         * 取出并删除最小的元素
+         *
+         * 只在删除成功后写入data，返回false时data保持原样
+         * 赋值抛出异常时元素已经从链表中删除
+         *
+         * @param data 返回被删除的数据
+         * @retval true 删除成功
+         * @retval false 链表为空
+         * @note 时间：O(1)(没有竞争时), 空间：O(1)，无锁
+         */
+        bool pop_front(DataType& data) {
+                EpochReclaimer::Guard guard;
+                Position pos;
+                while(true) {
+                        pos._prev = &_head;
+                        pos._curr = pointer(_head.load(std::memory_order_acquire));
+                        if(pos._curr == nullptr) {
+                                return false;
+                        }
+                        std::uintptr_t next = pos._curr -> _next.load(std::memory_order_acquire);
+                        pos._next = pointer(next);
+                        if(marked(next)) {
+                                std::uintptr_t expected = link(pos._curr);
+                                if(_head.compare_exchange_strong(expected, link(pos._next))) {
+                                        EpochReclaimer::retire(pos._curr, deleteNode);
+                                }
+                                continue;
+                        }
+                        if(unlink(pos)) {
+                                data = pos._curr -> _data; // 节点已退休，但在guard结束前不会释放
+                                return true;
+                        }
+                }
+        }
+private:
+        /**
+         * @brief 把新节点插入到合适的位置
+         *
+         * 已有相等的元素时释放新节点
+         *
+         * @param node 新节点，尚未被其他线程看到
+         * @return 是否插入
+         */
+        bool insertNode(Node* node) {
+                EpochReclaimer::Guard guard;
+                Position pos;
+                while(true) {
+                        if(find(node -> _data, pos)) {
+                                delete node;
+                                return false;
+                        }
+                        node -> _next.store(link(pos._curr), std::memory_order_relaxed);
+                        std::uintptr_t expected = link(pos._curr);
+                        if(pos._prev -> compare_exchange_strong(expected, link(node))) {
+                                _length.fetch_add(1, std::memory_order_relaxed);
+                                return true;
+                        }
+                }
+        }
+}; ///< class ConcurrentLinkedList
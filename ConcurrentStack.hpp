@@ -0,0 +1,243 @@
+#pragma once
+/**
+ * @file ConcurrentStack.hpp
+ * @class ConcurrentStack
+ * @brief 一个基于模板的无锁栈(Treiber栈)
+ *
+ * 只支持头部操作：push_front() emplace_front() pop_front() pop_all()
+ * 所有操作都可以被任意多个线程同时调用
+ *
+ * pop_front()读取头结点后、CAS之前，头结点可能被其他线程弹出、释放并重新分配，
+ * 使CAS误以为头部没有变化(ABA问题)
+ * 这里弹出的节点交给EpochReclaimer延迟释放，读取期间节点地址不会被复用，从而避免ABA
+ *
+ * @author neOzkyol
+ * @date 2026-01-18
+ * @version 1.0
+ */
+#include <atomic> ///< std::atomic
+#include <type_traits> ///< std::is_nothrow_move_assignable std::true_type
+#include <utility> ///< std::move std::forward
+#include "EpochReclaimer.hpp"
+#include "LinkedList.hpp"
+template<typename DataType> ///< 栈存储的数据类型
+class ConcurrentStack {
+private:
+        struct Node { ///< 栈节点
+                DataType _data; ///< 每个节点的数据
+                Node* _next; ///< 指向下一个节点的指针，入栈后不再修改(pop_all()出错放回时除外，见restoreBatch())
+                template<typename... Args>
+                Node(Args&&... args): _data(std::forward<Args>(args)...), _next(nullptr){}
+        };
+        std::atomic<Node*> _head; ///< 栈顶
+        /**
+         * @brief 交给EpochReclaimer的释放函数，释放单个节点
+         *
+         * @param node 要释放的节点
+         */
+        static void deleteNode(void* node) {
+                delete static_cast<Node*>(node);
+        }
+        /**
+         * @brief 交给EpochReclaimer的释放函数，释放整条链
+         *
+         * @param head 链的第一个节点
+         * @note 时间：O(n), 空间：O(1)
+         */
+        static void deleteChain(void* head) {
+                Node* curr = static_cast<Node*>(head);
+                while(curr != nullptr) {
+                        Node* next = curr -> _next;
+                        delete curr;
+                        curr = next;
+                }
+        }
+        /**
+         * @brief 把新节点压入栈顶
+         *
+         * 只访问尚未公开的新节点和_head，不需要EpochReclaimer::Guard
+         *
+         * @param node 新节点
+         */
+        void pushNode(Node* node) noexcept {
+                pushChain(node, node);
+        }
+        /**
+         * @brief 把一条链整个压入栈顶
+         *
+         * 链中的节点不能被其他线程持有，last的_next会被改写
+         *
+         * @param first 链的第一个节点，成为新的栈顶
+         * @param last 链的最后一个节点
+         */
+        void pushChain(Node* first, Node* last) noexcept {
+                last -> _next = _head.load(std::memory_order_relaxed);
+                while(!_head.compare_exchange_weak(last -> _next, first,
+                        std::memory_order_release, std::memory_order_relaxed)) {}
+        }
+        /**
+         * @name pop_all()失败时保留摘下的元素
+         * @brief 调用前其他线程必须已经放开这些节点(EpochReclaimer::synchronize())
+         *
+         * 元素的移动赋值不抛出异常时，把已移出的元素移回原节点，保留整批节点
+         * 否则释放已移出元素的节点，只保留其余节点
+         *
+         * @param head 摘下的链的第一个节点
+         * @param failed 第一个没有移出元素的节点
+         * @param moved 已经移出的元素，与[head, failed)中的节点一一对应
+         * @return 保留下来的链的第一个节点
+         * @{
+         */
+        static Node* keepBatch(Node* head, Node*, LinkedList<DataType>& moved, std::true_type) noexcept {
+                Node* node = head;
+                for(auto& data : moved) {
+                        node -> _data = std::move(data);
+                        node = node -> _next;
+                }
+                return head;
+        }
+        static Node* keepBatch(Node* head, Node* failed, LinkedList<DataType>&, std::false_type) noexcept {
+                if(failed != head) {
+                        Node* prev = head;
+                        while(prev -> _next != failed) {
+                                prev = prev -> _next;
+                        }
+                        prev -> _next = nullptr;
+                        deleteChain(head);
+                }
+                return failed;
+        }
+        /** @} */
+        /**
+         * @brief pop_all()失败时把摘下的元素放回栈顶
+         *
+         * 先等待可能还持有这些节点的线程离开临界区，再修改和重新挂回
+         * 否则正在pop_front()的线程可能读到被改写的_next，或遇到重新入栈的同一节点(ABA)
+         *
+         * @param head 摘下的链的第一个节点
+         * @param failed 第一个没有移出元素的节点
+         * @param moved 已经移出的元素
+         */
+        void restoreBatch(Node* head, Node* failed, LinkedList<DataType>& moved) noexcept {
+                EpochReclaimer::synchronize();
+                Node* first = keepBatch(head, failed, moved, typename std::is_nothrow_move_assignable<DataType>::type());
+                Node* last = first;
+                while(last -> _next != nullptr) {
+                        last = last -> _next;
+                }
+                pushChain(first, last);
+        }
+public:
+        /**
+         * @brief 无参构造函数
+         *
+         * _head初始化为 nullptr
+         *
+         */
+        ConcurrentStack() noexcept: _head(nullptr){}
+        ConcurrentStack(const ConcurrentStack&) = delete;
+        ConcurrentStack& operator=(const ConcurrentStack&) = delete;
+        /**
+         * @brief 析构函数
+         *
+         * 调用时不能再有其他线程访问此栈
+         *
+         * @note 时间：O(n), 空间：O(1)
+         */
+        ~ConcurrentStack() {
+                deleteChain(_head.load());
+        }
+        /**
+         * @brief 栈是否为空
+         *
+         * 有其他线程同时修改时只是一个瞬间的快照
+         *
+         * @retval true 栈为空
+         * @retval false 反之
+         */
+        bool empty() const noexcept {
+                return _head.load(std::memory_order_relaxed) == nullptr;
+        }
+        /**
+         * @name 头插入
+         * @brief 压入一个元素
+         *
+         * 分为拷贝、移动和原地构造三个版本
+         *
+         * @note 时间：O(1)(没有竞争时), 空间：O(1)，无锁
+         * @{
+         */
+        void push_front(const DataType& data) {
+                pushNode(new Node(data));
+        }
+        void push_front(DataType&& data) {
+                pushNode(new Node(std::move(data)));
+        }
+        template<typename... Args>
+        void emplace_front(Args&&... args) {
+                pushNode(new Node(std::forward<Args>(args)...));
+        }
+        /** @} */
+        /**
+         * @brief 头删除
+         *
+         * 弹出栈顶元素
+         *
+         * @param data 返回被弹出的数据
+         * @retval true 弹出成功
+         * @retval false 栈为空
+         * @note 时间：O(1)(没有竞争时), 空间：O(1)，无锁
+         */
+        bool pop_front(DataType& data) {
+                EpochReclaimer::Guard guard;
+                Node* head = _head.load(std::memory_order_acquire);
+                while(head != nullptr) {
+                        if(_head.compare_exchange_weak(head, head -> _next,
+                                std::memory_order_acquire, std::memory_order_acquire)) {
+                                data = std::move(head -> _data);
+                                EpochReclaimer::retire(head, deleteNode);
+                                return true;
+                        }
+                }
+                return false;
+        }
+        /**
+         * @brief 批量删除
+         *
+         * 用一次原子交换摘下整个栈，之后的遍历不再需要原子操作
+         * 元素按出栈顺序(后进先出)移入返回的LinkedList
+         * 摘下的节点作为一整条链交给EpochReclaimer延迟释放
+         *
+         * 构造链表时抛出异常(如分配节点失败)，摘下的元素不会丢失：
+         * 先等待可能还持有这些节点的线程离开临界区(EpochReclaimer::synchronize())，再把节点挂回栈顶
+         * 元素的移动赋值不抛出异常时，已移入链表的元素也先移回原节点，整批元素都回到栈中；
+         * 否则只有尚未移出的元素回到栈中
+         *
+         * @warning 出错时会等待其他线程，所以调用者不能持有EpochReclaimer::Guard
+         * @return 包含所有元素的链表，栈为空时返回空链表
+         * @note 时间：O(n), 空间：O(n)
+         */
+        LinkedList<DataType> pop_all() {
+                LinkedList<DataType> result;
+                Node* head = _head.exchange(nullptr, std::memory_order_acquire);
+                if(head == nullptr) {
+                        return result;
+                }
+                Node* curr = head;
+                try {
+                        for(; curr != nullptr; curr = curr -> _next) {
+                                result.push_back(std::move(curr -> _data));
+                        }
+                } catch(...) {
+                        restoreBatch(head, curr, result);
+                        throw;
+                }
+                try {
+                        EpochReclaimer::retire(head, deleteChain);
+                } catch(...) {
+                        EpochReclaimer::synchronize();
+                        deleteChain(head);
+                }
+                return result;
+        }
+}; ///< class ConcurrentStack
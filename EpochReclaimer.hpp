@@ -0,0 +1,234 @@
+#pragma once
+/**
+ * @file EpochReclaimer.hpp
+ * @class EpochReclaimer
+ * @brief 无锁结构使用的基于纪元(epoch)的内存回收
+ *
+ * 无锁结构中摘下的节点可能仍被其他线程读取，不能像LinkedList那样立即delete
+ * 每次操作前用Guard进入临界区，并登记当前的全局纪元
+ * 摘下节点的线程调用retire()而不是delete，节点按纪元分袋存放
+ * 所有在临界区中的线程都登记了最新纪元后，全局纪元才能前进
+ * 全局纪元前进两次之后，之前摘下的节点不可能再被任何线程读取，可以释放
+ *
+ * 与危险指针相比，遍历时不需要为每个节点登记和加内存屏障，每次操作只有一次屏障
+ * 代价是一个长时间停在临界区中的线程会阻止所有回收
+ *
+ * 每个线程第一次使用时领取一条记录，线程退出时归还，供后来的线程复用
+ * 全进程共用一个实例
+ *
+ * @author neOzkyol
+ * @date 2026-01-17
+ * @version 1.0
+ */
+#include <atomic> ///< std::atomic
+#include <cstddef> ///< std::size_t
+#include <cstdint> ///< std::uint64_t
+#include <thread> ///< std::this_thread::yield
+#include <vector> ///< std::vector
+class EpochReclaimer {
+private:
+        static const int Bags = 3; ///< 纪元g的袋子在纪元g+3复用时，其中的节点一定可以释放
+        static const int AdvanceInterval = 64; ///< 每retire()这么多次尝试推进一次全局纪元
+        struct Retired { ///< 等待释放的节点
+                void* _ptr; ///< 节点地址
+                void (*_deleter)(void*); ///< 释放函数
+        };
+        struct Record { ///< 每个线程一条的记录
+                /**
+                 * @brief 登记的纪元
+                 *
+                 * 最低位为1表示在临界区中，其余位为进入时的全局纪元
+                 * 为0表示不在临界区中
+                 * 64位：纪元左移一位后仍不会丢失最高位
+                 *
+                 */
+                std::atomic<std::uint64_t> _announced;
+                std::atomic<bool> _owned; ///< 是否有线程正在使用这条记录
+                Record* _next; ///< 下一条记录，记录只增不减
+                int _nesting; ///< Guard的嵌套层数，只由持有者访问
+                std::size_t _retireCount; ///< retire()的次数，只由持有者访问，无符号以便溢出后回绕
+                std::vector<Retired> _bags[Bags]; ///< 按纪元分袋的待释放节点，只由持有者访问
+                std::uint64_t _bagEpochs[Bags]; ///< 每个袋子对应的纪元
+                Record(): _announced(0), _owned(true), _next(nullptr), _nesting(0), _retireCount(0) {
+                        for(auto& epoch : _bagEpochs) {
+                                epoch = 0;
+                        }
+                }
+        };
+        /**
+         * @brief 线程局部的记录持有者
+         *
+         * 线程退出时归还记录
+         * 还没有释放的节点留在记录中，由下一个使用这条记录的线程继续处理
+         *
+         */
+        struct LocalRecord {
+                Record* _record;
+                LocalRecord(): _record(instance().acquire()) {}
+                ~LocalRecord() {
+                        _record -> _announced.store(0);
+                        _record -> _owned.store(false);
+                }
+        };
+        std::atomic<std::uint64_t> _epoch; ///< 全局纪元，64位在任何推进速度下都不会回绕
+        std::atomic<Record*> _records; ///< 所有记录组成的链表
+
+        EpochReclaimer() noexcept: _epoch(1), _records(nullptr) {}
+        EpochReclaimer(const EpochReclaimer&) = delete;
+        EpochReclaimer& operator=(const EpochReclaimer&) = delete;
+        /**
+         * @brief 析构函数
+         *
+         * 进程退出时调用，此时不应再有线程使用无锁结构
+         * 释放所有剩余的节点和记录
+         *
+         */
+        ~EpochReclaimer() {
+                Record* curr = _records.load();
+                while(curr != nullptr) {
+                        for(auto& bag : curr -> _bags) {
+                                freeBag(bag);
+                        }
+                        auto temp = curr;
+                        curr = curr -> _next;
+                        delete temp;
+                }
+        }
+        /**
+         * @brief 领取一条记录
+         *
+         * 优先复用已归还的记录，没有时新建一条挂到链表头部
+         *
+         * @return 记录的指针
+         */
+        Record* acquire() {
+                for(Record* curr = _records.load(); curr != nullptr; curr = curr -> _next) {
+                        bool expected = false;
+                        if(curr -> _owned.compare_exchange_strong(expected, true)) {
+                                return curr;
+                        }
+                }
+                Record* record = new Record();
+                Record* head = _records.load();
+                do {
+                        record -> _next = head;
+                } while(!_records.compare_exchange_weak(head, record));
+                return record;
+        }
+        /**
+         * @brief 释放一个袋子中的全部节点
+         *
+         * @param bag 要清空的袋子
+         */
+        static void freeBag(std::vector<Retired>& bag) {
+                for(auto& retired : bag) {
+                        retired._deleter(retired._ptr);
+                }
+                bag.clear();
+        }
+        /**
+         * @brief 尝试推进全局纪元
+         *
+         * 只要有一个在临界区中的线程还停留在旧纪元，就放弃
+         *
+         * @note 时间：O(线程数)
+         */
+        void tryAdvance() {
+                std::uint64_t epoch = _epoch.load();
+                for(Record* curr = _records.load(); curr != nullptr; curr = curr -> _next) {
+                        std::uint64_t announced = curr -> _announced.load();
+                        if((announced & 1) != 0 && (announced >> 1) != epoch) {
+                                return;
+                        }
+                }
+                _epoch.compare_exchange_strong(epoch, epoch + 1);
+        }
+        /**
+         * @brief 获取当前线程的记录
+         *
+         * @return 记录的指针
+         */
+        static Record* local() {
+                static thread_local LocalRecord record;
+                return record._record;
+        }
+        /**
+         * @brief 获取全进程唯一的实例
+         *
+         * @return 实例的引用
+         */
+        static EpochReclaimer& instance() {
+                static EpochReclaimer reclaimer;
+                return reclaimer;
+        }
+public:
+        /**
+         * @class Guard
+         * @brief 临界区
+         *
+         * 构造时进入，析构时离开，可以嵌套
+         * 在Guard的生命周期内读取到的节点不会被释放
+         *
+         */
+        class Guard {
+        private:
+                Record* _record; ///< 当前线程的记录
+        public:
+                Guard(): _record(local()) {
+                        if(_record -> _nesting++ == 0) {
+                                std::uint64_t epoch = instance()._epoch.load(std::memory_order_relaxed);
+                                _record -> _announced.store((epoch << 1) | 1, std::memory_order_seq_cst);
+                        }
+                }
+                ~Guard() {
+                        if(--_record -> _nesting == 0) {
+                                _record -> _announced.store(0, std::memory_order_release);
+                        }
+                }
+                Guard(const Guard&) = delete;
+                Guard& operator=(const Guard&) = delete;
+        }; ///< class Guard
+        /**
+         * @brief 延迟释放一个已经摘下的节点
+         *
+         * 调用者保证节点已经无法从结构中到达
+         * 节点放进当前纪元的袋子，袋子在三个纪元之后复用时统一释放
+         *
+         * @param ptr 节点地址
+         * @param deleter 释放函数
+         * @note 时间：均摊O(1)
+         */
+        static void retire(void* ptr, void (*deleter)(void*)) {
+                Record* record = local();
+                EpochReclaimer& reclaimer = instance();
+                std::uint64_t epoch = reclaimer._epoch.load();
+                int bag = static_cast<int>(epoch % Bags);
+                if(record -> _bagEpochs[bag] != epoch) {
+                        freeBag(record -> _bags[bag]);
+                        record -> _bagEpochs[bag] = epoch;
+                }
+                record -> _bags[bag].push_back(Retired{ptr, deleter});
+                if(++record -> _retireCount % AdvanceInterval == 0) {
+                        reclaimer.tryAdvance();
+                }
+        }
+        /**
+         * @brief 等待调用前已在临界区中的线程全部离开
+         *
+         * 返回后，调用前从结构中读取到的节点不再被任何线程持有，
+         * 已摘下的节点可以直接释放或修改后重新挂回结构
+         * 全局纪元前进两次即可保证这一点，等待期间让出CPU
+         * 用于出错处理等少见的场合，正常路径应使用retire()
+         *
+         * @warning 调用者不能持有Guard，否则永远等不到
+         * @note 时间：取决于其他线程停留在临界区中的时间
+         */
+        static void synchronize() noexcept {
+                EpochReclaimer& reclaimer = instance();
+                const std::uint64_t target = reclaimer._epoch.load() + 2;
+                while(reclaimer._epoch.load() < target) {
+                        reclaimer.tryAdvance();
+                        std::this_thread::yield();
+                }
+        }
+}; ///< class EpochReclaimer
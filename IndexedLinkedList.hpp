@@ -0,0 +1,810 @@
+#pragma once
+/**
+ * @file IndexedLinkedList.hpp
+ * @class IndexedLinkedList
+ * @brief 一个带跳表索引的单向链表
+ *
+ * 节点仍然通过最底层的_next串成一条单向链表，迭代器只沿着这一层走
+ * 每个节点另外随机拥有若干层"快车道"：第i层指向后面第一个高度超过i的节点
+ * 每条车道记录跨过的元素个数(span)，所以可以按索引跳跃前进
+ *
+ * 按索引访问/插入/删除的期望时间为O(log n)，LinkedList为O(n)
+ * 元素保持有序时(只用insert_sorted()插入)，按值查找也是O(log n)
+ * 代价是每个节点平均多约1.33条车道，每条车道一个指针和一个int
+ *
+ * @author neOzkyol
+ * @date 2026-01-18
+ * @version 1.0
+ */
+#include <iterator> ///< std::forward_iterator_tag
+#include <cstddef> ///< std::ptrdiff_t std::size_t std::max_align_t
+#include <cstdint> ///< std::uint32_t
+#include <stdexcept> ///< std::out_of_range std::logic_error
+#include <memory> ///< std::allocator std::allocator_traits
+#include <new> ///< placement new
+#include <utility> ///< std::move std::forward
+#include <initializer_list> ///< std::initializer_list
+/**
+ * @tparam DataType 链表存储的数据类型
+ * @tparam Allocator 分配器，内部重绑定到 std::max_align_t 按字节块分配节点
+ */
+template<typename DataType, typename Allocator = std::allocator<DataType>>
+class IndexedLinkedList {
+private:
+        static const int MaxLevel = 32; ///< 最多的层数，足够索引2^64个元素
+        struct Node;
+        struct Lane { ///< 一层车道
+                Node* _next; ///< 这一层的下一个节点
+                int _span; ///< 到_next跨过的元素个数，_next为 nullptr 时无意义
+        };
+        /**
+         * @brief 链表节点
+         *
+         * 节点内存的布局为 [Node][Lane × _height]
+         * 第0层车道就是普通单向链表的_next
+         *
+         */
+        struct Node {
+                DataType _data; ///< 每个节点的数据
+                int _height; ///< 车道层数
+                template<typename... Args>
+                Node(int height, Args&&... args): _data(std::forward<Args>(args)...), _height(height){}
+        };
+        static_assert(alignof(DataType) <= alignof(std::max_align_t), "IndexedLinkedList does not support over-aligned types");
+        using Unit = std::max_align_t; ///< 分配的基本单位
+        using UnitAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Unit>;
+        using UnitAllocTraits = std::allocator_traits<UnitAllocator>;
+        static const std::size_t LaneOffset = (sizeof(Node) + alignof(Lane) - 1) / alignof(Lane) * alignof(Lane); ///< 车道数组在节点中的偏移
+
+        Lane _head[MaxLevel]; ///< 头结点之前的位置的各层车道
+        int _level; ///< 当前用到的层数，至少为1
+        Node* _tail; ///< 链表尾结点，链表为空时为 nullptr
+        int _length; ///< 链表的长度
+        std::uint32_t _seed; ///< 决定新节点高度的随机数状态
+        UnitAllocator _alloc; ///< 所有节点都通过它分配和释放
+
+        /**
+         * @name 节点与车道的互相转换
+         * @{
+         */
+        static Lane* lanesOf(Node* node) noexcept {
+                return reinterpret_cast<Lane*>(reinterpret_cast<char*>(node) + LaneOffset);
+        }
+        static const Lane* lanesOf(const Node* node) noexcept {
+                return reinterpret_cast<const Lane*>(reinterpret_cast<const char*>(node) + LaneOffset);
+        }
+        /** @} */
+        /**
+         * @brief 节点占用的分配单位数
+         *
+         * @param height 车道层数
+         * @return 单位数
+         */
+        static std::size_t unitsFor(int height) noexcept {
+                return (LaneOffset + height * sizeof(Lane) + sizeof(Unit) - 1) / sizeof(Unit);
+        }
+        /**
+         * @brief 随机决定新节点的高度
+         *
+         * 每一层以1/4的概率继续向上，期望高度为4/3
+         * xorshift32，足够均匀且没有额外开销
+         *
+         * @return 1到MaxLevel之间的高度
+         */
+        int randomHeight() noexcept {
+                int height = 1;
+                while(height < MaxLevel) {
+                        _seed ^= _seed << 13;
+                        _seed ^= _seed >> 17;
+                        _seed ^= _seed << 5;
+                        if((_seed & 3) != 0) {
+                                break;
+                        }
+                        height++;
+                }
+                return height;
+        }
+        /**
+         * @brief 创建一个节点
+         *
+         * 链表内部自用函数
+         * 构造抛出异常时释放已分配的内存，然后继续抛出
+         *
+         * @param args 转发给DataType构造函数的参数
+         * @return 新节点，车道尚未初始化
+         */
+        template<typename... Args>
+        Node* createNode(Args&&... args) {
+                const int height = randomHeight();
+                Unit* raw = UnitAllocTraits::allocate(_alloc, unitsFor(height));
+                try {
+                        return ::new(static_cast<void*>(raw)) Node(height, std::forward<Args>(args)...);
+                } catch(...) {
+                        UnitAllocTraits::deallocate(_alloc, raw, unitsFor(height));
+                        throw;
+                }
+        }
+        /**
+         * @brief 销毁一个节点
+         *
+         * @param node 要销毁的节点
+         */
+        void destroyNode(Node* node) noexcept {
+                const int height = node -> _height;
+                node -> ~Node();
+                UnitAllocTraits::deallocate(_alloc, reinterpret_cast<Unit*>(node), unitsFor(height));
+        }
+        /**
+         * @brief 重置为空链表，不释放节点
+         *
+         * 链表内部自用函数
+         *
+         */
+        void reset() noexcept {
+                for(auto& lane : _head) {
+                        lane._next = nullptr;
+                        lane._span = 0;
+                }
+                _level = 1;
+                _tail = nullptr;
+                _length = 0;
+        }
+        /**
+         * @brief 寻找第rank个元素之前的各层位置
+         *
+         * 链表内部自用函数
+         * 各层都前进到跨过的元素数不超过rank的最后一个位置
+         *
+         * @param rank 跨过的元素个数，即目标位置的索引
+         * @param update 返回各层停下的车道
+         * @param ranks 返回各层停下时跨过的元素个数
+         * @note 时间：期望O(log n), 空间：O(1)
+         */
+        void findByIndex(int rank, Lane** update, int* ranks) noexcept {
+                Lane* lanes = _head;
+                int traversed = 0;
+                for(int i = _level - 1; i >= 0; i--) {
+                        while(lanes[i]._next != nullptr && traversed + lanes[i]._span <= rank) {
+                                traversed += lanes[i]._span;
+                                lanes = lanesOf(lanes[i]._next);
+                        }
+                        update[i] = &lanes[i];
+                        ranks[i] = traversed;
+                }
+        }
+        /**
+         * @brief 寻找第一个不小于(或大于)data的元素之前的各层位置
+         *
+         * 链表内部自用函数，要求链表有序
+         * 只读取链表，operator<抛出异常时链表不变
+         *
+         * @param data 目标值
+         * @param upper 为true时跳过与data相等的元素
+         * @param update 返回各层停下的车道
+         * @param ranks 返回各层停下时跨过的元素个数
+         * @note 时间：期望O(log n), 空间：O(1)
+         */
+        void findByValue(const DataType& data, bool upper, Lane** update, int* ranks) {
+                Lane* lanes = _head;
+                int traversed = 0;
+                for(int i = _level - 1; i >= 0; i--) {
+                        while(lanes[i]._next != nullptr && (upper? !(data < lanes[i]._next -> _data): lanes[i]._next -> _data < data)) {
+                                traversed += lanes[i]._span;
+                                lanes = lanesOf(lanes[i]._next);
+                        }
+                        update[i] = &lanes[i];
+                        ranks[i] = traversed;
+                }
+        }
+        /**
+         * @brief 把新节点链接到findByIndex()/findByValue()找到的位置
+         *
+         * 链表内部自用函数，只修改指针，不会抛出异常
+         *
+         * @param node 新节点
+         * @param update 各层停下的车道，高于_level的层在此补上
+         * @param ranks 各层停下时跨过的元素个数
+         */
+        void link(Node* node, Lane** update, int* ranks) noexcept {
+                const int height = node -> _height;
+                for(int i = _level; i < height; i++) {
+                        update[i] = &_head[i];
+                        ranks[i] = 0;
+                        _head[i]._span = _length;
+                }
+                if(height > _level) {
+                        _level = height;
+                }
+                const int index = ranks[0];
+                Lane* lanes = lanesOf(node);
+                for(int i = 0; i < height; i++) {
+                        lanes[i]._next = update[i] -> _next;
+                        lanes[i]._span = update[i] -> _span - (index - ranks[i]);
+                        update[i] -> _next = node;
+                        update[i] -> _span = index - ranks[i] + 1;
+                }
+                for(int i = height; i < _level; i++) {
+                        update[i] -> _span++;
+                }
+                if(lanes[0]._next == nullptr) {
+                        _tail = node;
+                }
+                _length++;
+        }
+        /**
+         * @brief 摘下并销毁update[0]之后的节点
+         *
+         * 链表内部自用函数
+         *
+         * @param update findByIndex()找到的各层车道
+         */
+        void unlink(Lane** update) noexcept {
+                Node* target = update[0] -> _next;
+                Lane* lanes = lanesOf(target);
+                for(int i = 0; i < _level; i++) {
+                        if(update[i] -> _next == target) {
+                                update[i] -> _span += lanes[i]._span - 1;
+                                update[i] -> _next = lanes[i]._next;
+                        } else {
+                                update[i] -> _span--;
+                        }
+                }
+                if(target == _tail) {
+                        _tail = update[0] == &_head[0]? nullptr:
+                                reinterpret_cast<Node*>(reinterpret_cast<char*>(update[0]) - LaneOffset);
+                }
+                while(_level > 1 && _head[_level - 1]._next == nullptr) {
+                        _level--;
+                }
+                _length--;
+                destroyNode(target);
+        }
+        /**
+         * @brief 在指定位置插入新节点
+         *
+         * 链表内部自用函数，insert()等的实现
+         * 先检查索引，再创建节点，索引非法时不会分配内存
+         *
+         * @param index 插入后新元素的索引
+         * @param args 转发给DataType构造函数的参数
+         * @return 新元素的引用
+         */
+        template<typename... Args>
+        DataType& emplaceAt(int index, Args&&... args) {
+                if(index < 0 || index > _length) {
+                        throw std::out_of_range("index out of range");
+                }
+                Node* node = createNode(std::forward<Args>(args)...);
+                Lane* update[MaxLevel];
+                int ranks[MaxLevel];
+                findByIndex(index, update, ranks);
+                link(node, update, ranks);
+                return node -> _data;
+        }
+        /**
+         * @brief 获取指定位置的节点
+         *
+         * 链表内部自用函数，不做范围检查
+         *
+         * @param index 目标索引
+         * @return 节点
+         * @note 时间：期望O(log n), 空间：O(1)
+         */
+        Node* nodeAt(int index) const noexcept {
+                const Lane* lanes = _head;
+                int traversed = 0;
+                const int rank = index + 1;
+                for(int i = _level - 1; i >= 0; i--) {
+                        while(lanes[i]._next != nullptr && traversed + lanes[i]._span <= rank) {
+                                traversed += lanes[i]._span;
+                                if(traversed == rank) {
+                                        return lanes[i]._next;
+                                }
+                                lanes = lanesOf(lanes[i]._next);
+                        }
+                }
+                return nullptr;
+        }
+public:
+        using allocator_type = Allocator; ///< 对接STL
+        /**
+         * @name 链表构造函数
+         * @{
+         */
+
+        /**
+         * @brief 无参构造函数
+         *
+         * 所有车道初始化为空，_level初始化为 1
+         *
+         */
+        IndexedLinkedList(): _level(1), _tail(nullptr), _length(0), _seed(2463534242u), _alloc() {
+                reset();
+        }
+        /**
+         * @brief 指定分配器的构造函数
+         *
+         * @param alloc 要使用的分配器
+         */
+        explicit IndexedLinkedList(const Allocator& alloc):
+                _level(1), _tail(nullptr), _length(0), _seed(2463534242u), _alloc(alloc) {
+                reset();
+        }
+        /**
+         * @brief 初始化列表构造函数
+         *
+         * @param init 初始元素
+         * @param alloc 要使用的分配器
+         * @note 时间：期望O(n log n), 空间：O(n)
+         */
+        IndexedLinkedList(std::initializer_list<DataType> init, const Allocator& alloc = Allocator()):
+                IndexedLinkedList(alloc) {
+                for(const auto& data : init) {
+                        push_back(data);
+                }
+        }
+        /**
+         * @brief 拷贝构造函数
+         *
+         * 逐个push_back()，各节点高度重新随机
+         *
+         * @param other 被拷贝的链表
+         * @note 时间：期望O(n log n), 空间：O(n)
+         */
+        IndexedLinkedList(const IndexedLinkedList& other):
+                IndexedLinkedList(UnitAllocTraits::select_on_container_copy_construction(other._alloc)) {
+                for(const auto& data : other) {
+                        push_back(data);
+                }
+        }
+        /**
+         * @brief 移动构造函数
+         *
+         * 接管other的全部节点，other随后为空
+         *
+         * @param other 被移动的链表
+         * @note 时间：O(MaxLevel), 空间：O(1)
+         */
+        IndexedLinkedList(IndexedLinkedList&& other) noexcept:
+                _level(other._level), _tail(other._tail), _length(other._length),
+                _seed(other._seed), _alloc(std::move(other._alloc)) {
+                for(int i = 0; i < MaxLevel; i++) {
+                        _head[i] = other._head[i];
+                }
+                other.reset();
+        }
+        /**
+         * @brief 拷贝赋值函数
+         *
+         * 先拷贝再交换，拷贝抛出异常时此链表不变
+         *
+         * @param other 被拷贝的链表
+         * @return 当前链表
+         */
+        IndexedLinkedList& operator=(const IndexedLinkedList& other) {
+                if(this != &other) {
+                        IndexedLinkedList temp(other);
+                        *this = std::move(temp);
+                }
+                return *this;
+        }
+        /**
+         * @brief 移动赋值函数
+         *
+         * 释放此链表原有的节点，再接管other的全部节点
+         * 要求分配器在移动时传播或两者相等
+         *
+         * @param other 被移动的链表
+         * @return 当前链表
+         */
+        IndexedLinkedList& operator=(IndexedLinkedList&& other) noexcept {
+                if(this == &other) {
+                        return *this;
+                }
+                clean();
+                for(int i = 0; i < MaxLevel; i++) {
+                        _head[i] = other._head[i];
+                }
+                _level = other._level;
+                _tail = other._tail;
+                _length = other._length;
+                _alloc = std::move(other._alloc);
+                other.reset();
+                return *this;
+        }
+        /** @} */
+        /**
+         * @brief 析构函数
+         *
+         * @sa clean()
+         * @note 时间：O(n), 空间：O(1)
+         */
+        ~IndexedLinkedList() {
+                clean();
+        }
+        /**
+         * @brief 获取分配器
+         *
+         * @return 由_alloc重绑定回DataType得到的分配器副本
+         */
+        allocator_type get_allocator() const {
+                return allocator_type(_alloc);
+        }
+
+        class ConstIterator;
+        /**
+         * @class Iterator
+         * @brief IndexedLinkedList的内置迭代器
+         *
+         * 只沿第0层车道前进，与LinkedList::Iterator一样是单向的
+         *
+         */
+        class Iterator {
+        private:
+                Node* _curr; ///< 迭代器当前指向的节点
+                friend class IndexedLinkedList; ///< 使IndexedLinkedList能访问Iterator私有成员
+                friend class ConstIterator; ///< 使ConstIterator能从Iterator构造
+        public:
+                /**
+                 * @brief 对接STL
+                 * @{
+                 */
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = DataType;
+                using difference_type = std::ptrdiff_t;
+                using pointer = DataType*;
+                using reference = DataType&;
+                /** @} */
+                explicit Iterator(Node* node = nullptr) noexcept: _curr(node){}
+                DataType& operator*() const noexcept {
+                        return _curr -> _data;
+                }
+                DataType* operator->() const noexcept {
+                        return &(_curr -> _data);
+                }
+                Iterator& operator++() noexcept {
+                        _curr = lanesOf(_curr)[0]._next;
+                        return *this;
+                }
+                Iterator operator++(int) noexcept {
+                        auto temp = *this;
+                        _curr = lanesOf(_curr)[0]._next;
+                        return temp;
+                }
+                bool operator==(const Iterator& other) const noexcept {
+                        return _curr == other._curr;
+                }
+                bool operator!=(const Iterator& other) const noexcept {
+                        return !(*this == other);
+                }
+        }; ///< class Iterator
+
+        /**
+         * @class ConstIterator
+         * @brief IndexedLinkedList的内置Const迭代器
+         *
+         * @see Iterator
+         */
+        class ConstIterator {
+        private:
+                const Node* _curr; ///< 迭代器当前指向的节点
+                friend class IndexedLinkedList; ///< 使IndexedLinkedList能访问ConstIterator私有成员
+        public:
+                /**
+                 * @brief 对接STL
+                 * @{
+                 */
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = DataType;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const DataType*;
+                using reference = const DataType&;
+                /** @} */
+                explicit ConstIterator(const Node* node = nullptr) noexcept: _curr(node){}
+                ConstIterator(const Iterator& it) noexcept: _curr(it._curr){}
+                const DataType& operator*() const noexcept {
+                        return _curr -> _data;
+                }
+                const DataType* operator->() const noexcept {
+                        return &(_curr -> _data);
+                }
+                ConstIterator& operator++() noexcept {
+                        _curr = lanesOf(_curr)[0]._next;
+                        return *this;
+                }
+                ConstIterator operator++(int) noexcept {
+                        auto temp = *this;
+                        _curr = lanesOf(_curr)[0]._next;
+                        return temp;
+                }
+                bool operator==(const ConstIterator& other) const noexcept {
+                        return _curr == other._curr;
+                }
+                bool operator!=(const ConstIterator& other) const noexcept {
+                        return !(*this == other);
+                }
+        }; ///< class ConstIterator
+
+        /**
+         * @name 迭代器
+         * @brief 与LinkedList相同
+         * @{
+         */
+        Iterator begin() noexcept {
+                return Iterator(_head[0]._next);
+        }
+        ConstIterator begin() const noexcept {
+                return ConstIterator(_head[0]._next);
+        }
+        ConstIterator cbegin() const noexcept {
+                return ConstIterator(_head[0]._next);
+        }
+        Iterator end() noexcept {
+                return Iterator(nullptr);
+        }
+        ConstIterator end() const noexcept {
+                return ConstIterator(nullptr);
+        }
+        ConstIterator cend() const noexcept {
+                return ConstIterator(nullptr);
+        }
+        /** @} */
+
+        /**
+         * @name 下标访问
+         * @brief 沿车道按span跳跃
+         *
+         * 在所索引超出范围时抛出异常
+         *
+         * @param index 目标索引
+         * @return 元素的引用
+         * @note 时间：期望O(log n), 空间：O(1)
+         * @{
+         */
+        DataType& operator[](int index) {
+                if(index < 0 || index >= _length) {
+                        throw std::out_of_range("index out of range");
+                }
+                return nodeAt(index) -> _data;
+        }
+        const DataType& operator[](int index) const {
+                if(index < 0 || index >= _length) {
+                        throw std::out_of_range("index out of range");
+                }
+                return nodeAt(index) -> _data;
+        }
+        /** @} */
+        /**
+         * @brief 获取链表长度
+         *
+         * @return _length成员
+         */
+        int size() const noexcept {
+                return _length;
+        }
+        /**
+         * @brief 链表是否为空
+         *
+         * @retval true 链表为空
+         * @retval false 反之
+         */
+        bool empty() const noexcept {
+                return _length == 0;
+        }
+        /**
+         * @brief 清空链表
+         *
+         * 沿第0层逐个销毁节点
+         *
+         * @note 时间：O(n), 空间：O(1)
+         */
+        void clean() noexcept {
+                Node* curr = _head[0]._next;
+                while(curr != nullptr) {
+                        Node* next = lanesOf(curr)[0]._next;
+                        destroyNode(curr);
+                        curr = next;
+                }
+                reset();
+        }
+        /**
+         * @name 获取头尾元素
+         * @brief 链表为空时抛出异常
+         * @{
+         */
+        DataType& front() {
+                if(empty()) {
+                        throw std::logic_error("cannot get front of empty list");
+                }
+                return _head[0]._next -> _data;
+        }
+        const DataType& front() const {
+                if(empty()) {
+                        throw std::logic_error("cannot get front of empty list");
+                }
+                return _head[0]._next -> _data;
+        }
+        DataType& back() {
+                if(empty()) {
+                        throw std::logic_error("cannot get back of empty list");
+                }
+                return _tail -> _data;
+        }
+        const DataType& back() const {
+                if(empty()) {
+                        throw std::logic_error("cannot get back of empty list");
+                }
+                return _tail -> _data;
+        }
+        /** @} */
+        /**
+         * @name 指定位置插入
+         * @brief 插入后新元素的索引为index
+         *
+         * 当索引超出范围时抛出异常
+         * 构造抛出异常时链表不变
+         *
+         * @param index 要插入的位置
+         * @param data 要插入的数据
+         * @note 时间：期望O(log n), 空间：O(1)
+         * @{
+         */
+        void insert(int index, const DataType& data) {
+                emplaceAt(index, data);
+        }
+        void insert(int index, DataType&& data) {
+                emplaceAt(index, std::move(data));
+        }
+        template<typename... Args>
+        DataType& emplace(int index, Args&&... args) {
+                return emplaceAt(index, std::forward<Args>(args)...);
+        }
+        /** @} */
+        /**
+         * @name 头尾插入
+         * @brief 等价于insert(0, data)和insert(size(), data)
+         *
+         * @param data 要插入的数据
+         * @note 时间：期望O(log n), 空间：O(1)
+         * @{
+         */
+        void push_front(const DataType& data) {
+                emplaceAt(0, data);
+        }
+        void push_front(DataType&& data) {
+                emplaceAt(0, std::move(data));
+        }
+        void push_back(const DataType& data) {
+                emplaceAt(_length, data);
+        }
+        void push_back(DataType&& data) {
+                emplaceAt(_length, std::move(data));
+        }
+        /** @} */
+        /**
+         * @brief 删除指定元素
+         *
+         * 索引超出范围时抛出异常
+         *
+         * @param index 要删除的元素的索引
+         * @note 时间：期望O(log n), 空间：O(1)
+         */
+        void erase(int index) {
+                if(index < 0 || index >= _length) {
+                        throw std::out_of_range("index out of range");
+                }
+                Lane* update[MaxLevel];
+                int ranks[MaxLevel];
+                findByIndex(index, update, ranks);
+                unlink(update);
+        }
+        /**
+         * @name 头尾删除
+         * @brief 链表为空时抛出异常
+         *
+         * 单向链表的pop_back()在这里也是期望O(log n)
+         *
+         * @note 时间：期望O(log n), 空间：O(1)
+         * @{
+         */
+        void pop_front() {
+                if(empty()) {
+                        throw std::logic_error("cannot pop from empty list");
+                }
+                erase(0);
+        }
+        void pop_back() {
+                if(empty()) {
+                        throw std::logic_error("cannot pop from empty list");
+                }
+                erase(_length - 1);
+        }
+        /** @} */
+        /**
+         * @brief 寻找元素的索引
+         *
+         * 链表无序，只能沿第0层逐个比较
+         * 链表有序时应使用find_sorted()
+         *
+         * @param data 要寻找的数据
+         * @retval >=0 找到的索引
+         * @retval -1 未找到
+         * @note 时间：O(n), 空间：O(1)
+         */
+        int find_index(const DataType& data) const {
+                int index = 0;
+                for(const auto& item : *this) {
+                        if(item == data) {
+                                return index;
+                        }
+                        index++;
+                }
+                return -1;
+        }
+        /**
+         * @name 有序链表操作
+         * @brief 链表按operator<升序排列时可用
+         *
+         * 只用insert_sorted()插入即可保持有序
+         * 在无序链表上调用结果未指定，但不会破坏链表
+         *
+         * @note 时间：期望O(log n), 空间：O(1)
+         * @{
+         */
+
+        /**
+         * @brief 按顺序插入
+         *
+         * 与已有元素相等时插入在它们之后(稳定)
+         * 先找到位置再创建节点，operator<或构造抛出异常时链表不变，也不会泄漏内存
+         *
+         * @param data 要插入的数据
+         * @return 新元素的索引
+         */
+        int insert_sorted(const DataType& data) {
+                Lane* update[MaxLevel];
+                int ranks[MaxLevel];
+                findByValue(data, true, update, ranks);
+                link(createNode(data), update, ranks);
+                return ranks[0];
+        }
+        int insert_sorted(DataType&& data) {
+                Lane* update[MaxLevel];
+                int ranks[MaxLevel];
+                findByValue(data, true, update, ranks);
+                link(createNode(std::move(data)), update, ranks);
+                return ranks[0];
+        }
+        /**
+         * @brief 第一个不小于data的元素的索引
+         *
+         * @param data 目标值
+         * @return 索引，所有元素都小于data时为size()
+         */
+        int lower_bound_index(const DataType& data) const {
+                const Lane* lanes = _head;
+                int traversed = 0;
+                for(int i = _level - 1; i >= 0; i--) {
+                        while(lanes[i]._next != nullptr && lanes[i]._next -> _data < data) {
+                                traversed += lanes[i]._span;
+                                lanes = lanesOf(lanes[i]._next);
+                        }
+                }
+                return traversed;
+        }
+        /**
+         * @brief 寻找等于data的第一个元素的索引
+         *
+         * @param data 要寻找的数据
+         * @retval >=0 找到的索引
+         * @retval -1 未找到
+         */
+        int find_sorted(const DataType& data) const {
+                const int index = lower_bound_index(data);
+                if(index == _length || data < nodeAt(index) -> _data) {
+                        return -1;
+                }
+                return index;
+        }
+        /** @} */
+}; ///< class IndexedLinkedList
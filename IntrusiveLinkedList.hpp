@@ -0,0 +1,592 @@
+#pragma once
+/**
+ * @file IntrusiveLinkedList.hpp
+ * @class IntrusiveLinkedList
+ * @brief 一个基于模板的侵入式单向链表
+ *
+ * LinkedList为每个元素分配一个Node，并把元素拷贝或移动到Node::_data中
+ * 侵入式链表不分配节点：元素自己含有一个IntrusiveListHook成员，链表只串起这些钩子
+ * 因此链表不拥有元素，也从不分配、拷贝、移动或析构元素
+ * 元素的生命周期由使用者管理，元素在链表中时不能被销毁或移动
+ *
+ * 用法：
+ * @code
+ * struct Task {
+ *         int id;
+ *         IntrusiveListHook hook;
+ * };
+ * IntrusiveLinkedList<Task, &Task::hook> queue;
+ * Task t{1, {}};
+ * queue.push_back(t);
+ * @endcode
+ *
+ * 一个钩子同一时刻只能在一个链表中，想同时放进多个链表需要多个钩子
+ * 除越界和空链表删除会抛出异常外，所有操作都不抛出异常
+ *
+ * @author neOzkyol
+ * @date 2026-01-18
+ * @version 1.0
+ */
+#include <iterator> ///< std::forward_iterator_tag
+#include <cstddef> ///< std::ptrdiff_t
+#include <stdexcept> ///< std::out_of_range std::logic_error
+#include <type_traits> ///< std::aligned_storage
+/**
+ * @brief 嵌入在元素中的链接钩子
+ *
+ * 拷贝元素时钩子不随之拷贝，新元素的钩子总是未链接状态
+ *
+ */
+struct IntrusiveListHook {
+        IntrusiveListHook* _next; ///< 指向下一个元素的钩子
+        IntrusiveListHook() noexcept: _next(nullptr){}
+        IntrusiveListHook(const IntrusiveListHook&) noexcept: _next(nullptr){}
+        IntrusiveListHook& operator=(const IntrusiveListHook&) noexcept {
+                return *this;
+        }
+};
+/**
+ * @tparam DataType 元素类型
+ * @tparam Hook 元素中钩子成员的成员指针，如 &Task::hook
+ */
+template<typename DataType, IntrusiveListHook DataType::*Hook>
+class IntrusiveLinkedList {
+private:
+        /**
+         * @brief 链表头结点之前的位置
+         *
+         * 与LinkedList相同，_beforeHead._next 才是首元素的钩子
+         *
+         */
+        IntrusiveListHook _beforeHead;
+        IntrusiveListHook* _tail; ///< 尾元素的钩子，链表为空时为 nullptr
+        int _length; ///< 链表的长度
+        /**
+         * @brief 钩子在元素中的偏移
+         *
+         * 在一块未构造的、对齐的内存上计算，不需要DataType可默认构造
+         *
+         * @return 偏移字节数
+         */
+        static std::ptrdiff_t hookOffset() noexcept {
+                typename std::aligned_storage<sizeof(DataType), alignof(DataType)>::type storage;
+                DataType* object = reinterpret_cast<DataType*>(&storage);
+                return reinterpret_cast<char*>(&(object ->* Hook)) - reinterpret_cast<char*>(object);
+        }
+        /**
+         * @name 钩子与元素的互相转换
+         * @{
+         */
+        static IntrusiveListHook* hookOf(DataType& data) noexcept {
+                return &(data.*Hook);
+        }
+        static DataType* ownerOf(IntrusiveListHook* hook) noexcept {
+                return reinterpret_cast<DataType*>(reinterpret_cast<char*>(hook) - hookOffset());
+        }
+        static const DataType* ownerOf(const IntrusiveListHook* hook) noexcept {
+                return reinterpret_cast<const DataType*>(reinterpret_cast<const char*>(hook) - hookOffset());
+        }
+        /** @} */
+        /**
+         * @brief 把钩子链接到pos之后
+         *
+         * 链表内部自用函数
+         * hook成为最后一个时更新_tail
+         *
+         * @param pos 新钩子的前驱，可以是_beforeHead
+         * @param hook 新钩子
+         */
+        void linkAfter(IntrusiveListHook* pos, IntrusiveListHook* hook) noexcept {
+                hook -> _next = pos -> _next;
+                pos -> _next = hook;
+                if(hook -> _next == nullptr) {
+                        _tail = hook;
+                }
+                _length++;
+        }
+        /**
+         * @brief 摘下pos之后的钩子
+         *
+         * 链表内部自用函数，pos之后必须有元素
+         * 摘下的是最后一个时更新_tail
+         *
+         * @param pos 被摘下钩子的前驱，可以是_beforeHead
+         */
+        void unlinkAfter(IntrusiveListHook* pos) noexcept {
+                auto target = pos -> _next;
+                pos -> _next = target -> _next;
+                target -> _next = nullptr;
+                if(target == _tail) {
+                        _tail = pos == &_beforeHead? nullptr: pos;
+                }
+                _length--;
+        }
+        /**
+         * @brief 获取索引处元素的前驱钩子
+         *
+         * 链表内部自用函数，不做范围检查
+         *
+         * @param index 目标索引，0的前驱为_beforeHead
+         * @return 前驱钩子
+         * @note 时间：O(n), 空间：O(1)
+         */
+        IntrusiveListHook* hookBefore(int index) noexcept {
+                IntrusiveListHook* prev = &_beforeHead;
+                for(int i = 0; i < index; i++) {
+                        prev = prev -> _next;
+                }
+                return prev;
+        }
+public:
+        /**
+         * @brief 无参构造函数
+         *
+         * _beforeHead._next初始化为 nullptr
+         * _tail初始化为 nullptr
+         * _length初始化为 0
+         *
+         */
+        IntrusiveLinkedList() noexcept: _beforeHead(), _tail(nullptr), _length(0){}
+        IntrusiveLinkedList(const IntrusiveLinkedList&) = delete;
+        IntrusiveLinkedList& operator=(const IntrusiveLinkedList&) = delete;
+        /**
+         * @brief 移动构造函数
+         *
+         * 接管other的全部元素，other随后为空
+         *
+         * @param other 被移动的链表
+         * @note 时间：O(1), 空间：O(1)
+         */
+        IntrusiveLinkedList(IntrusiveLinkedList&& other) noexcept:
+                _beforeHead(), _tail(other._tail), _length(other._length) {
+                _beforeHead._next = other._beforeHead._next;
+                other._beforeHead._next = nullptr;
+                other._tail = nullptr;
+                other._length = 0;
+        }
+        /**
+         * @brief 移动赋值函数
+         *
+         * 先摘下此链表原有的元素，再接管other的全部元素
+         *
+         * @param other 被移动的链表
+         * @return 当前链表
+         * @note 时间：O(n), 空间：O(1)
+         */
+        IntrusiveLinkedList& operator=(IntrusiveLinkedList&& other) noexcept {
+                if(this == &other) {
+                        return *this;
+                }
+                clean();
+                _beforeHead._next = other._beforeHead._next;
+                _tail = other._tail;
+                _length = other._length;
+                other._beforeHead._next = nullptr;
+                other._tail = nullptr;
+                other._length = 0;
+                return *this;
+        }
+        /**
+         * @brief 析构函数
+         *
+         * 摘下所有元素，元素本身不受影响
+         *
+         * @note 时间：O(n), 空间：O(1)
+         */
+        ~IntrusiveLinkedList() {
+                clean();
+        }
+
+        class ConstIterator;
+        /**
+         * @class Iterator
+         * @brief IntrusiveLinkedList的内置迭代器
+         *
+         * 与LinkedList::Iterator相同，指向钩子，解引用时换算成所在的元素
+         *
+         */
+        class Iterator {
+        private:
+                IntrusiveListHook* _curr; ///< 迭代器当前指向的钩子，before_begin()时指向_beforeHead
+                friend class IntrusiveLinkedList; ///< 使IntrusiveLinkedList能访问Iterator私有成员
+                friend class ConstIterator; ///< 使ConstIterator能从Iterator构造
+        public:
+                /**
+                 * @brief 对接STL
+                 * @{
+                 */
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = DataType;
+                using difference_type = std::ptrdiff_t;
+                using pointer = DataType*;
+                using reference = DataType&;
+                /** @} */
+                explicit Iterator(IntrusiveListHook* hook = nullptr) noexcept: _curr(hook){}
+                DataType& operator*() const noexcept {
+                        return *ownerOf(_curr);
+                }
+                DataType* operator->() const noexcept {
+                        return ownerOf(_curr);
+                }
+                Iterator& operator++() noexcept {
+                        _curr = _curr -> _next;
+                        return *this;
+                }
+                Iterator operator++(int) noexcept {
+                        auto temp = *this;
+                        _curr = _curr -> _next;
+                        return temp;
+                }
+                bool operator==(const Iterator& other) const noexcept {
+                        return _curr == other._curr;
+                }
+                bool operator!=(const Iterator& other) const noexcept {
+                        return !(*this == other);
+                }
+        }; ///< class Iterator
+
+        /**
+         * @class ConstIterator
+         * @brief IntrusiveLinkedList的内置Const迭代器
+         *
+         * @see Iterator
+         */
+        class ConstIterator {
+        private:
+                const IntrusiveListHook* _curr; ///< 迭代器当前指向的钩子，before_begin()时指向_beforeHead
+                friend class IntrusiveLinkedList; ///< 使IntrusiveLinkedList能访问ConstIterator私有成员
+        public:
+                /**
+                 * @brief 对接STL
+                 * @{
+                 */
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = DataType;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const DataType*;
+                using reference = const DataType&;
+                /** @} */
+                explicit ConstIterator(const IntrusiveListHook* hook = nullptr) noexcept: _curr(hook){}
+                ConstIterator(const Iterator& it) noexcept: _curr(it._curr){}
+                const DataType& operator*() const noexcept {
+                        return *ownerOf(_curr);
+                }
+                const DataType* operator->() const noexcept {
+                        return ownerOf(_curr);
+                }
+                ConstIterator& operator++() noexcept {
+                        _curr = _curr -> _next;
+                        return *this;
+                }
+                ConstIterator operator++(int) noexcept {
+                        auto temp = *this;
+                        _curr = _curr -> _next;
+                        return temp;
+                }
+                bool operator==(const ConstIterator& other) const noexcept {
+                        return _curr == other._curr;
+                }
+                bool operator!=(const ConstIterator& other) const noexcept {
+                        return !(*this == other);
+                }
+        }; ///< class ConstIterator
+
+        /**
+         * @name 迭代器
+         * @brief 与LinkedList相同
+         *
+         * before_begin()不能解引用，只能作为 *_after 系列函数的位置参数
+         *
+         * @{
+         */
+        Iterator before_begin() noexcept {
+                return Iterator(&_beforeHead);
+        }
+        ConstIterator before_begin() const noexcept {
+                return ConstIterator(&_beforeHead);
+        }
+        ConstIterator cbefore_begin() const noexcept {
+                return ConstIterator(&_beforeHead);
+        }
+        Iterator begin() noexcept {
+                return Iterator(_beforeHead._next);
+        }
+        ConstIterator begin() const noexcept {
+                return ConstIterator(_beforeHead._next);
+        }
+        ConstIterator cbegin() const noexcept {
+                return ConstIterator(_beforeHead._next);
+        }
+        Iterator end() noexcept {
+                return Iterator(nullptr);
+        }
+        ConstIterator end() const noexcept {
+                return ConstIterator(nullptr);
+        }
+        ConstIterator cend() const noexcept {
+                return ConstIterator(nullptr);
+        }
+        /** @} */
+
+        /**
+         * @name 由元素获取迭代器
+         * @brief 元素自带钩子，所以无需遍历
+         *
+         * data必须在此链表中
+         *
+         * @param data 链表中的元素
+         * @return 指向data的迭代器
+         * @note 时间：O(1), 空间：O(1)
+         * @{
+         */
+        Iterator iterator_to(DataType& data) noexcept {
+                return Iterator(hookOf(data));
+        }
+        ConstIterator iterator_to(const DataType& data) const noexcept {
+                return ConstIterator(&(data.*Hook));
+        }
+        /** @} */
+        /**
+         * @name 下标访问
+         * @brief 在所索引超出范围时抛出异常
+         *
+         * @param index 目标索引
+         * @return 元素的引用
+         * @note 时间：O(n), 空间：O(1)
+         * @{
+         */
+        DataType& operator[](int index) {
+                if(index < 0 || index >= _length) {
+                        throw std::out_of_range("index out of range");
+                }
+                return *ownerOf(hookBefore(index) -> _next);
+        }
+        const DataType& operator[](int index) const {
+                if(index < 0 || index >= _length) {
+                        throw std::out_of_range("index out of range");
+                }
+                return *ownerOf(const_cast<IntrusiveLinkedList*>(this) -> hookBefore(index) -> _next);
+        }
+        /** @} */
+        /**
+         * @brief 获取链表长度
+         *
+         * @return _length成员
+         */
+        int size() const noexcept {
+                return _length;
+        }
+        /**
+         * @brief 链表是否为空
+         *
+         * @retval true 链表为空
+         * @retval false 反之
+         */
+        bool empty() const noexcept {
+                return _beforeHead._next == nullptr;
+        }
+        /**
+         * @brief 清空链表
+         *
+         * 摘下所有元素并重置它们的钩子，元素本身不受影响
+         *
+         * @note 时间：O(n), 空间：O(1)
+         */
+        void clean() noexcept {
+                while(_beforeHead._next != nullptr) {
+                        auto temp = _beforeHead._next;
+                        _beforeHead._next = temp -> _next;
+                        temp -> _next = nullptr;
+                }
+                _tail = nullptr;
+                _length = 0;
+        }
+        /**
+         * @brief 寻找元素的索引
+         *
+         * 按地址比较，即寻找data这个对象本身，而不是与它相等的值
+         *
+         * @param data 要寻找的元素
+         * @retval >=0 找到的索引
+         * @retval -1 不在此链表中
+         * @note 时间：O(n), 空间：O(1)
+         */
+        int find_index(const DataType& data) const noexcept {
+                int index = 0;
+                for(auto hook = _beforeHead._next; hook != nullptr; hook = hook -> _next) {
+                        if(ownerOf(hook) == &data) {
+                                return index;
+                        }
+                        index++;
+                }
+                return -1;
+        }
+        /**
+         * @name 获取头尾元素
+         * @brief 链表为空时抛出异常
+         * @{
+         */
+        DataType& front() {
+                if(empty()) {
+                        throw std::logic_error("cannot get front of empty list");
+                }
+                return *ownerOf(_beforeHead._next);
+        }
+        const DataType& front() const {
+                if(empty()) {
+                        throw std::logic_error("cannot get front of empty list");
+                }
+                return *ownerOf(_beforeHead._next);
+        }
+        DataType& back() {
+                if(empty()) {
+                        throw std::logic_error("cannot get back of empty list");
+                }
+                return *ownerOf(_tail);
+        }
+        const DataType& back() const {
+                if(empty()) {
+                        throw std::logic_error("cannot get back of empty list");
+                }
+                return *ownerOf(_tail);
+        }
+        /** @} */
+        /**
+         * @name 插入
+         * @brief 把data链接进链表，不拷贝
+         *
+         * data不能已经在某个链表中
+         *
+         * @param data 要插入的元素
+         * @{
+         */
+
+        /**
+         * @brief 头插入
+         *
+         * @note 时间：O(1), 空间：O(1)
+         */
+        void push_front(DataType& data) noexcept {
+                linkAfter(&_beforeHead, hookOf(data));
+        }
+        /**
+         * @brief 尾插入
+         *
+         * @note 时间：O(1), 空间：O(1)
+         */
+        void push_back(DataType& data) noexcept {
+                linkAfter(_tail == nullptr? &_beforeHead: _tail, hookOf(data));
+        }
+        /**
+         * @brief 在指定索引插入
+         *
+         * 索引超出范围时抛出异常，index == size() 时插入到末尾
+         *
+         * @param index 插入后data所在的索引
+         * @note 时间：O(n), 空间：O(1)
+         */
+        void insert(int index, DataType& data) {
+                if(index < 0 || index > _length) {
+                        throw std::out_of_range("index out of range");
+                }
+                linkAfter(index == _length && _tail != nullptr? _tail: hookBefore(index), hookOf(data));
+        }
+        /**
+         * @brief 在pos之后插入
+         *
+         * @param pos 插入位置的前驱，可以是before_begin()
+         * @return 指向data的迭代器
+         * @note 时间：O(1), 空间：O(1)
+         */
+        Iterator insert_after(ConstIterator pos, DataType& data) noexcept {
+                auto hook = hookOf(data);
+                linkAfter(const_cast<IntrusiveListHook*>(pos._curr), hook);
+                return Iterator(hook);
+        }
+        /** @} */
+        /**
+         * @name 删除
+         * @brief 把元素摘出链表，不析构
+         *
+         * 摘下的元素钩子被重置，可以再放进其他链表
+         *
+         * @{
+         */
+
+        /**
+         * @brief 头删除
+         *
+         * 链表为空时抛出异常
+         *
+         * @note 时间：O(1), 空间：O(1)
+         */
+        void pop_front() {
+                if(empty()) {
+                        throw std::logic_error("cannot pop from empty list");
+                }
+                unlinkAfter(&_beforeHead);
+        }
+        /**
+         * @brief 尾删除
+         *
+         * 链表为空时抛出异常
+         * 单向链表需要找到尾元素的前驱
+         *
+         * @note 时间：O(n), 空间：O(1)
+         */
+        void pop_back() {
+                if(empty()) {
+                        throw std::logic_error("cannot pop from empty list");
+                }
+                unlinkAfter(hookBefore(_length - 1));
+        }
+        /**
+         * @brief 删除指定索引的元素
+         *
+         * 索引超出范围时抛出异常
+         *
+         * @param index 要删除的元素的索引
+         * @note 时间：O(n), 空间：O(1)
+         */
+        void erase(int index) {
+                if(index < 0 || index >= _length) {
+                        throw std::out_of_range("index out of range");
+                }
+                unlinkAfter(hookBefore(index));
+        }
+        /**
+         * @brief 删除pos之后的元素
+         *
+         * pos之后必须有元素
+         *
+         * @param pos 被删除元素的前驱，可以是before_begin()
+         * @return 指向被删除元素之后的迭代器
+         * @note 时间：O(1), 空间：O(1)
+         */
+        Iterator erase_after(ConstIterator pos) noexcept {
+                auto prev = const_cast<IntrusiveListHook*>(pos._curr);
+                unlinkAfter(prev);
+                return Iterator(prev -> _next);
+        }
+        /**
+         * @brief 删除data这个元素
+         *
+         * 按地址寻找，data不在此链表中时什么也不做
+         *
+         * @param data 要删除的元素
+         * @retval true 已删除
+         * @retval false 不在此链表中
+         * @note 时间：O(n), 空间：O(1)
+         */
+        bool remove(DataType& data) noexcept {
+                auto target = hookOf(data);
+                for(IntrusiveListHook* prev = &_beforeHead; prev -> _next != nullptr; prev = prev -> _next) {
+                        if(prev -> _next == target) {
+                                unlinkAfter(prev);
+                                return true;
+                        }
+                }
+                return false;
+        }
+        /** @} */
+}; ///< class IntrusiveLinkedList
@@ -8,15 +8,60 @@
  * @date 2026-01-17
  * @version 1.0
  */
-#include <iterator> ///< std::forward_iterator_tag
+#include <iterator> ///< std::forward_iterator_tag std::make_move_iterator
 #include <cstddef> ///< std::ptrdiff_t
 #include <stdexcept> ///< std::out_of_range std::logic_error
-template<typename DataType> ///< 链表存储的数据类型
-class LinkedList {
+#include <memory> ///< std::allocator std::allocator_traits
+#include <new> ///< 定位new
+#include <utility> ///< std::move std::forward std::move_if_noexcept
+#include <type_traits> ///< std::true_type std::false_type std::is_trivially_destructible std::is_empty
+#include <initializer_list> ///< std::initializer_list
+#include <exception> ///< std::exception_ptr
+#include "ListStats.hpp" ///< NoListStats ListOperation
+#if __cplusplus >= 202002L && __has_include(<ranges>)
+#include <ranges> ///< std::ranges::input_range
+#endif
+/**
+ * @brief 遍历时的预取距离
+ *
+ * 大于0时，内部遍历(查找、计数、clean()等)和for_each()/accumulate()的默认版本
+ * 让一个指针领先这么多个节点，并预取它所指的节点；迭代器递增时预取下一个节点
+ * 只对远大于缓存的链表有收益，所以默认为0，即不预取
+ * 编译时定义，例如 -DLINKEDLIST_PREFETCH_DISTANCE=8
+ */
+#ifndef LINKEDLIST_PREFETCH_DISTANCE
+#define LINKEDLIST_PREFETCH_DISTANCE 0
+#endif
+class ThreadPool; ///< parallel_sort()和clear_async()的默认线程池，使用时需包含 ThreadPool.hpp
+/**
+ * @tparam DataType 链表存储的数据类型
+ * @tparam Allocator 分配器，内部会通过 std::allocator_traits 重绑定到 Node
+ *
+ * 默认使用 std::allocator
+ * 频繁增删的场景可以换成 PoolAllocator.hpp 中的 PoolAllocator
+ * @tparam Stats 统计策略，见 ListStats.hpp
+ *
+ * 默认的NoListStats什么也不记录，换成ListStats后可以通过stats()查看链表的使用情况
+ */
+template<typename DataType, typename Allocator = std::allocator<DataType>, typename Stats = NoListStats>
+class LinkedList: private ListStatsStorage<Stats> {
 private:
-        struct Node { ///< 链表节点
-                DataType _data; ///< 每个节点的数据
+        using ListStatsStorage<Stats>::statsRecorder; ///< 统计，NoListStats不占空间，也不产生任何代码
+        struct EmplaceTag {}; ///< 区分原地构造的Node构造函数
+        struct Node;
+        /**
+         * @brief 只含_next的节点基类
+         *
+         * 链表的 before_begin() 位置就是一个NodeBase
+         * 这样在首元素之前插入/拼接时不需要特殊处理
+         *
+         */
+        struct NodeBase {
                 Node* _next; ///< 指向下一个节点的指针
+                NodeBase(Node* next = nullptr) noexcept: _next(next){}
+        };
+        struct Node: NodeBase { ///< 链表节点
+                DataType _data; ///< 每个节点的数据
                 /**
                  * @name 单个节点构造函数
                  * @brief 对成员进行初始化
@@ -29,288 +74,1148 @@ private:
                   * _next成员初始化为 nullptr
                   *
                   */
-                Node(): _next(nullptr){}
+                Node(): NodeBase(nullptr){}
                 /**
                  * @brief 有参构造函数
                  *
-                 * _data成员初始化为传入的 data
+                 * _data成员拷贝自传入的 data
+                 * _next成员初始化为 nullptr
+                 *
+                 * @param data 初始数据
+                 */
+                Node(const DataType& data): NodeBase(nullptr), _data(data){}
+                /**
+                 * @brief 有参构造函数 -移动版
+                 *
+                 * _data成员从传入的 data 移动构造
                  * _next成员初始化为 nullptr
                  *
                  * @param data 初始数据
                  */
-                Node(DataType data): _data(data), _next(nullptr){}
+                Node(DataType&& data): NodeBase(nullptr), _data(std::move(data)){}
                 /**
                  * @brief 有参构造函数
                  *
-                 * _data成员初始化为传入的 data
+                 * _data成员拷贝自传入的 data
+                 * _next成员初始化为传入的 next
+                 *
+                 * @param data 初始数据
+                 * @param next 此节点指向的下一个节点
+                 */
+                Node(const DataType& data, Node* next): NodeBase(next), _data(data){}
+                /**
+                 * @brief 有参构造函数 -移动版
+                 *
+                 * _data成员从传入的 data 移动构造
                  * _next成员初始化为传入的 next
                  *
                  * @param data 初始数据
                  * @param next 此节点指向的下一个节点
                  */
-                Node(DataType data, Node* next): _data(data), _next(next){}
+                Node(DataType&& data, Node* next): NodeBase(next), _data(std::move(data)){}
+                /**
+                 * @brief 原地构造函数
+                 *
+                 * _data成员直接用 args 构造，不产生临时的DataType
+                 * _next成员初始化为 nullptr
+                 *
+                 * @param args 转发给DataType构造函数的参数
+                 */
+                template<typename... Args>
+                Node(EmplaceTag, Args&&... args): NodeBase(nullptr), _data(std::forward<Args>(args)...){}
                 /** @} */
         };
         /**
-         * @brief 链表头结点
+         * @brief 重绑定到Node的分配器类型
+         * @{
+         */
+        using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+        using NodeAllocTraits = std::allocator_traits<NodeAllocator>;
+        /** @} */
+        /**
+         * @brief 分配器是否总是相等
+         *
+         * 总是相等时splice_after()、append()只修改指针，不会抛出异常
+         *
+         */
+        using AllocAlwaysEqual = typename NodeAllocTraits::is_always_equal;
+        /**
+         * @brief 链表头结点之前的位置
+         *
+         * 它本身不存数据，_beforeHead._next 才是头结点(数据节点)
+         * 链表为空时 _beforeHead._next 为 nullptr
+         *
+         */
+        NodeBase _beforeHead;
+        /**
+         * @brief 链表尾结点
+         *
+         * 始终指向最后一个数据节点
+         * 链表为空时为 nullptr
+         * 每个修改链表的函数都负责维护它
+         *
+         */
+        Node* _tail;
+        /**
+         * @brief 下标访问的游标
          *
-         * 这是一个数据节点，而非哨兵节点
+         * 记住上一次按索引访问、插入、删除到的(索引, 节点, 前驱)
+         * 下一次访问的索引不小于它时从这里继续向后走，而不是从头开始
+         * 因此 for(i = 0; i < size(); i++) l[i] 这样的循环每次访问均摊O(1)
+         * 记住前驱是为了在游标处插入或删除(如 if(l[i] == x) l.erase(i))时也不必从头寻找
+         * 改变已有元素索引的函数都负责使它失效或修正它
          *
+         * @sa locate() enable_access_cursor()
          */
-        Node* _head;
+        struct Cursor {
+                Node* _node = nullptr; ///< 游标处的节点，nullptr 表示游标无效
+                NodeBase* _prev = nullptr; ///< _node的前驱，_node是头结点时为&_beforeHead
+                int _index = 0; ///< _node的索引
+        };
+        Cursor* _cursor; ///< 开启游标后才分配，未开启时为 nullptr，链表对象只多占一个指针
         int _length; ///< 链表的长度
+        NodeAllocator _alloc; ///< 所有节点都通过它分配和释放
         /**
-         * @brief 寻找最后一个节点
+         * @brief 创建一个节点
          *
          * 链表内部自用函数
-         * 是异常安全的，不修改链表
+         * 先通过_alloc分配内存，再在其上构造Node
+         * 构造抛出异常时会释放已分配的内存，然后继续抛出
          *
-         * @return 链表最后一个节点的指针
-         * @note 时间：O(n), 空间：O(1)
+         * @param args 转发给Node构造函数的参数
+         * @return 新节点的指针
+         * @note 时间：O(1), 空间：O(1)
          */
-        Node* lastNodePtr() const noexcept{
-                if(_head == nullptr) {
-                        return nullptr;
-                }
-                auto curr = _head;
-                while(curr -> _next != nullptr) {
-                        curr = curr -> _next;
+        template<typename... Args>
+        Node* createNode(Args&&... args) {
+                Node* newNode = NodeAllocTraits::allocate(_alloc, 1);
+                try {
+                        NodeAllocTraits::construct(_alloc, newNode, std::forward<Args>(args)...);
+                } catch(...) {
+                        NodeAllocTraits::deallocate(_alloc, newNode, 1);
+                        throw;
                 }
-                return curr;
+                statsRecorder().on_allocate(1);
+                return newNode;
         }
         /**
-         * @brief 在删除之前进行检查
+         * @brief 销毁一个节点
          *
-         * 使用empty()检查是链表是否为空
-         * 如果链表为空，则抛出异常
-         * 处理了链表长度为1的情况：删除这个唯一的节点
+         * 链表内部自用函数
+         * 与createNode()对应：先析构，再把内存还给_alloc
          *
-         * @sa empty()
-         * @return 是否已经处理了删除操作
-         * @retval true 已经处理(空链表抛出异常或单节点已删除)
-         * @retval false 需要继续执行常规删除逻辑
+         * @sa createNode()
+         * @param node 要销毁的节点
+         * @note 时间：O(1), 空间：O(1)
          */
-        bool checkEmptyOrSingle() {
-                if(empty()) {
-                        throw std::logic_error("cannot pop from empty list");
-                } else if(_length == 1) {
-                        delete _head;
-                        _head = nullptr;
-                        _length = 0;
-                        return true;
-                }
-                return false;
+        void destroyNode(Node* node) noexcept {
+                NodeAllocTraits::destroy(_alloc, node);
+                NodeAllocTraits::deallocate(_alloc, node, 1);
+                statsRecorder().on_deallocate(1);
         }
-public:
         /**
-         * @name 链表构造函数
-         * @brief 对链表进行初始化
+         * @name 分配器的传播
+         * @brief 按照 allocator_traits 的 propagate_on_container_* 决定是否接管对方的分配器
          * @{
          */
-         
-         /**
-          * @brief 无参构造函数
-          *
-          * _head初始化为 nullptr
-          * _length初始化为 0
-          *
-          */
-        LinkedList() noexcept: _head(nullptr), _length(0){}
+        void copyAllocatorFrom(const LinkedList& other, std::true_type) {
+                _alloc = other._alloc;
+        }
+        void copyAllocatorFrom(const LinkedList&, std::false_type) noexcept {}
+        void moveAllocatorFrom(LinkedList& other, std::true_type) noexcept {
+                _alloc = std::move(other._alloc);
+        }
+        void moveAllocatorFrom(LinkedList&, std::false_type) noexcept {}
+        /** @} */
         /**
-         * @brief 拷贝构造函数
+         * @brief 接管另一个链表的全部节点
          *
-         * _head 先 初始化为 nullptr
-         * _length 先 初始化为 0
+         * 链表内部自用函数
+         * 调用前此链表必须为空，且两者的分配器可以互相释放对方的节点
          *
-         * @param other 拷贝给此链表的链表
-         * @note 时间：O(n), 空间：O(1)
+         * @param other 被接管的链表，之后置空
+         * @note 时间：O(1), 空间：O(1)
          */
-        LinkedList(const LinkedList& other): _head(nullptr), _length(0) {
-                auto curr = other._head;
-                while(curr != nullptr) {
-                        push_back(curr -> _data);
-                        curr = curr -> _next;
-                }
+        void stealNodes(LinkedList& other) noexcept {
+                invalidateCursor();
+                other.invalidateCursor();
+                _beforeHead._next = other._beforeHead._next;
+                _tail = other._tail;
+                _length = other._length;
+                statsRecorder().on_length(_length);
+                other._beforeHead._next = nullptr;
+                other._tail = nullptr;
+                other._length = 0;
         }
         /**
-         * @brief 赋值构造函数
+         * @brief 把other中before之后的元素移到pos之后
          *
-         * @param other 赋值给次链表的链表
-         * @return 当前链表
-         * @note 时间：O(n), 空间：O(1)
+         * 链表内部自用函数
+         * 两个链表的分配器不相等、不能互相释放节点时，代替直接转移节点
+         * 先在此链表中建好新节点，再销毁other中的原节点
+         * 抛出异常时两个链表都不变
+         *
+         * @param pos 新节点接在它的后面
+         * @param other 元素所在的链表
+         * @param before 被移动元素的前驱，它之后必须有节点
+         * @return 新节点
+         * @note 时间：O(1), 空间：O(1)
          */
-        LinkedList& operator=(const LinkedList& other) {
-                if(this == &other) {
-                        return *this;
-                }
-                clean();
-                auto curr = other._head;
-                while(curr != nullptr) {
-                        push_back(curr -> _data);
-                        curr = curr -> _next;
-                }
-                return *this;
+        Node* moveNodeAfter(NodeBase* pos, LinkedList& other, NodeBase* before) {
+                Node* node = createNode(std::move_if_noexcept(before -> _next -> _data));
+                linkAfter(pos, node);
+                other.destroyNode(other.unlinkAfter(before));
+                return node;
         }
         /**
-         * @brief 移动构造函数
+         * @name 链接新节点
+         * @brief 把已经创建好的节点接入链表
          *
-         * _head初始化为传入对象的_head
-         * _length初始化为传入对象的_length
+         * 链表内部自用函数
+         * 只修改指针，不会抛出异常
+         * 负责维护_beforeHead._next _tail _length
+         * 尾部链接不改变已有元素的索引，头部链接使游标索引加一，其余使游标失效
          *
-         * @param other 被接受的对象
-         * @note 被用作此对象初始化的对象将被置空
+         * @param node 要接入的节点
          * @note 时间：O(1), 空间：O(1)
+         * @{
          */
-        LinkedList(LinkedList&& other) noexcept: _head(other._head), _length(other._length) {
-                other._head = nullptr;
-                other._length = 0;
+        void linkFront(Node* node) noexcept {
+                if(_cursor != nullptr) {
+                        _cursor -> _index++;
+                        if(_cursor -> _prev == &_beforeHead) {
+                                _cursor -> _prev = node;
+                        }
+                }
+                node -> _next = _beforeHead._next;
+                if(_beforeHead._next == nullptr) {
+                        _tail = node;
+                }
+                _beforeHead._next = node;
+                _length++;
+                statsRecorder().on_length(_length);
+        }
+        void linkBack(Node* node) noexcept {
+                node -> _next = nullptr;
+                _tail == nullptr? _beforeHead._next = node: _tail -> _next = node;
+                _tail = node;
+                _length++;
+                statsRecorder().on_length(_length);
         }
         /**
-         * @brief 移动赋值构造函数
-         *
-         * _head初始化为传入对象的_head
-         * _length初始化为传入对象的_length
-         *
-         * @param other 被接受的对象
-         * @return 自己
-         * @note 被用作此对象初始化的对象将被置空
-         * @note 时间：O(1), 空间：O(1)
+         * @param pos 新节点接在它的后面，可以是&_beforeHead，不能为 nullptr
          */
-        LinkedList& operator=(LinkedList&& other) noexcept {
-                if(this == &other) {
-                        return *this;
+        void linkAfter(NodeBase* pos, Node* node) noexcept {
+                invalidateCursor();
+                node -> _next = pos -> _next;
+                pos -> _next = node;
+                if(node -> _next == nullptr) {
+                        _tail = node;
                 }
-                clean();
-                _head = other._head;
-                _length = other._length;
-                other._head = nullptr;
-                other._length = 0;
-                return *this;
+                _length++;
+                statsRecorder().on_length(_length);
         }
         /** @} */
-        
         /**
-         * @brief 析构函数
+         * @brief 把位置转换成可以作为_tail的节点
          *
-         * 调用clean()函数删除链表
+         * 链表内部自用函数
+         * &_beforeHead 表示链表中已没有节点，对应 nullptr
          *
-         * @sa clean()
-         * @note 时间：O(n), 空间：O(1)
+         * @param pos 链表中的某个位置
+         * @return 对应的数据节点，或 nullptr
          */
-        ~LinkedList() noexcept {
-                clean();
+        Node* tailFrom(NodeBase* pos) noexcept {
+                return pos == &_beforeHead? nullptr: static_cast<Node*>(pos);
         }
-        
+        static const int MaxSortPieces = 256; ///< parallel_sort()最多把链表切成的段数
+        static const int MinSortPiece = 16384; ///< parallel_sort()每段至少的元素个数，更短时线程开销不划算
         /**
-         * @class Iterator
-         * @brief LinkedList的内置迭代器
+         * @brief 对一段节点做归并排序
          *
-         * 部分未做nullptr检查
-         * 出于性能考虑
+         * 链表内部自用函数，sort()和parallel_sort()的一部分
+         * binHeads[i]存放一段长度为2^i的有序节点，逐个取下节点像二进制加一那样向上合并
+         * 合并总是发生在刚访问过的较短的段上，比整表逐轮扫描对缓存友好得多
+         * comp抛出异常时，(head, tail)仍是包含全部节点的一段(顺序未指定)
          *
+         * @param head 段的首节点，排序后为结果的首节点
+         * @param tail 段的尾节点，以 nullptr 结尾，排序后为结果的尾节点
+         * @param comp 严格弱序比较
+         * @note 时间：O(n log n), 空间：O(1)(固定大小的binHeads/binTails)
          */
-        class Iterator {
-        private:
-                Node* _curr;///< 迭代器当前指向的节点
-                friend class LinkedList;///< 使LinkedList能访问Iterator私有成员
-        public:
-                /**
-                 * @brief 对接STL
-                 * @{
-                 */
-                using iterator_category = std::forward_iterator_tag; ///< 此为单向链表
-                using value_type = DataType; ///< 数据类型为DataType
-                using difference_type = std::ptrdiff_t; ///< 此为距离类型
-                using pointer = DataType*; ///< 指针类型
-                using reference = DataType&; ///< 解引用时返回DataType&
-                /** @} */
-                
-                /**
-                 * @brief 构造函数
-                 *
-                 * 初始化成员，默认初始化为 nullptr
-                 * 异常安全
-                 *
-                 */
-                explicit Iterator(Node* ptr = nullptr) noexcept: _curr(ptr){}
-                /**
-                 * @brief 迭代器解引用
-                 *
-                 * 不修改链表,异常安全
-                 *
-                 * @return 迭代器指向的数据的引用
-                 */
-                DataType& operator*() const noexcept {
-                        return _curr -> _data;
-                }
-                /**
-                 * @brief 迭代器箭头运算符
-                 *
-                 * 不修改链表,异常安全
-                 *
-                 * @return 迭代器指向的数据的指针
-                 */
-                DataType* operator->() const noexcept {
-                        return &(_curr -> _data);
+        template<typename Compare>
+        static void sortChain(Node*& head, Node*& tail, Compare& comp) {
+                const int bins = sizeof(int) * 8;
+                Node* binHeads[bins] = {};
+                Node* binTails[bins] = {};
+                Node* carry = nullptr;
+                Node* carryTail = nullptr;
+                Node* rest = head;
+                Node* restTail = tail;
+                try {
+                        while(rest != nullptr) {
+                                carry = rest;
+                                carryTail = rest;
+                                rest = rest -> _next;
+                                carry -> _next = nullptr;
+                                int i = 0;
+                                for(; binHeads[i] != nullptr; i++) {
+                                        Node* later = carry;
+                                        carry = nullptr;
+                                        mergeRuns(binHeads[i], binTails[i], later, carryTail, comp);
+                                        carry = binHeads[i];
+                                        carryTail = binTails[i];
+                                        binHeads[i] = nullptr;
+                                }
+                                binHeads[i] = carry;
+                                binTails[i] = carryTail;
+                                carry = nullptr;
+                        }
+                        for(int i = 0; i < bins; i++) {
+                                if(binHeads[i] == nullptr) {
+                                        continue;
+                                }
+                                if(carry != nullptr) {
+                                        Node* later = carry;
+                                        carry = nullptr;
+                                        mergeRuns(binHeads[i], binTails[i], later, carryTail, comp);
+                                }
+                                carry = binHeads[i];
+                                carryTail = binTails[i];
+                                binHeads[i] = nullptr;
+                        }
+                } catch(...) {
+                        NodeBase all;
+                        NodeBase* last = &all;
+                        for(int i = 0; i < bins; i++) {
+                                if(binHeads[i] != nullptr) {
+                                        last -> _next = binHeads[i];
+                                        last = binTails[i];
+                                }
+                        }
+                        if(carry != nullptr) {
+                                last -> _next = carry;
+                                last = carryTail;
+                        }
+                        if(rest != nullptr) {
+                                last -> _next = rest;
+                                last = restTail;
+                        }
+                        last -> _next = nullptr;
+                        head = all._next;
+                        tail = static_cast<Node*>(last);
+                        throw;
                 }
-                /**
-                 * @brief 前置递增
-                 *
-                 * 异常安全
-                 *
-                 */
-                Iterator& operator++() noexcept {
-                        _curr = _curr -> _next;
-                        return *this;
+                head = carry;
+                tail = carryTail;
+        }
+        /**
+         * @brief 在线程池上执行task(0) ... task(count - 1)并等待全部结束
+         *
+         * 链表内部自用函数，parallel_sort()的一部分
+         * 提交或执行中抛出异常时，仍等待已提交的任务结束，再抛出第一个异常
+         *
+         * @param pool 线程池，需提供 submit()，返回的future需提供 get()
+         * @param count 任务数，不超过MaxSortPieces
+         * @param task 接受任务序号的函数
+         */
+        template<typename Pool, typename Task>
+        static void runParallel(Pool& pool, int count, Task& task) {
+                using Future = decltype(pool.submit(std::declval<void(*)()>()));
+                Future futures[MaxSortPieces];
+                std::exception_ptr error;
+                int submitted = 0;
+                try {
+                        for(; submitted < count; submitted++) {
+                                const int index = submitted;
+                                futures[index] = pool.submit([&task, index] { task(index); });
+                        }
+                } catch(...) {
+                        error = std::current_exception();
                 }
-                /**
-                 * @brief 后置递增
-                 *
-                 * 异常安全
-                 *
-                 * @param int 无用，做重载区分
-                 */
-                Iterator operator++(int) noexcept {
-                        auto temp = *this;
-                        _curr = _curr -> _next;
-                        return temp;
+                for(int i = 0; i < submitted; i++) {
+                        try {
+                                futures[i].get();
+                        } catch(...) {
+                                if(!error) {
+                                        error = std::current_exception();
+                                }
+                        }
                 }
-                /**
-                 * @brief ==比较重载
-                 *
-                 * 不修改链表,异常安全
-                 *
-                 */
-                bool operator==(const Iterator& other) const noexcept {
-                        return _curr == other._curr;
+                if(error) {
+                        std::rethrow_exception(error);
                 }
-                /**
-                 * @brief !=比较重载
-                 *
-                 * 基于迭代器的==重载
-                 * 不修改链表,异常安全
-                 *
-                 * @sa operator==
-                 */
-                bool operator!=(const Iterator& other) const noexcept {
-                        return !(*this == other);
+        }
+        /**
+         * @brief 预取一个节点
+         *
+         * 链表内部自用函数
+         * 节点超过一个缓存行时同时预取第二行，DataType较大时数据也能提前就位
+         *
+         * @param node 要预取的节点，不能为 nullptr
+         */
+        static void prefetchNode(const NodeBase* node) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+                __builtin_prefetch(node);
+                if(sizeof(Node) > 64) {
+                        __builtin_prefetch(reinterpret_cast<const char*>(node) + 64);
                 }
-        }; ///< class Iterator
-        
+#else
+                (void)node;
+#endif
+        }
         /**
-         * @class ConstIterator
-         * @brief LinkedList的内置Const迭代器
+         * @brief 从first开始沿_next访问每个节点
          *
-         * 部分未做nullptr检查
-         * 出于性能考虑
-         * 对比Iterator,主要修改在operator*()和operator->()
-         * 是Iterator的const版
+         * 链表内部自用函数
+         * Distance > 0 时另有一个指针领先Distance个节点，每前进一步预取它到达的节点
+         * 当前节点的_next在调用visit之前读出，所以visit可以销毁当前节点
          *
-         * @see Iterator
+         * @tparam Distance 预取距离，为0时就是普通的循环
+         * @param first 第一个节点，可以为 nullptr
+         * @param visit 访问函数，返回false时停止
+         * @return visit返回false时的节点，全部访问完时为 nullptr
+         * @note 时间：O(n), 空间：O(1)
          */
-        class ConstIterator {
-        private:
-                const Node* _curr;///< 迭代器当前指向的节点
+        template<int Distance, typename NodePtr, typename Visit>
+        static NodePtr walk(NodePtr first, Visit&& visit) {
+                NodePtr ahead = first;
+                for(int i = 0; i < Distance && ahead != nullptr; i++) {
+                        ahead = ahead -> _next;
+                }
+                for(NodePtr curr = first; curr != nullptr;) {
+                        NodePtr next = curr -> _next;
+                        if(Distance > 0 && ahead != nullptr) {
+                                ahead = ahead -> _next;
+                                if(ahead != nullptr) {
+                                        prefetchNode(ahead);
+                                }
+                        }
+                        if(!visit(curr)) {
+                                return curr;
+                        }
+                        curr = next;
+                }
+                return nullptr;
+        }
+        /**
+         * @brief 使游标失效
+         *
+         * 链表内部自用函数
+         *
+         */
+        void invalidateCursor() noexcept {
+                if(_cursor != nullptr) {
+                        _cursor -> _node = nullptr;
+                }
+        }
+        /**
+         * @name 获取索引处的节点和它的前驱
+         * @brief 游标有效且不在index之后时从游标出发，否则从头出发
+         *
+         * 链表内部自用函数，不做范围检查，index可以等于_length(此时返回 nullptr)
+         * 非const版本在游标开启时把结果记入游标
+         * const版本只读取游标，所以多个线程同时调用它仍然是安全的
+         *
+         * @param index 目标索引
+         * @param prev 返回索引处节点的前驱，index为0时是&_beforeHead
+         * @return 索引处的节点
+         * @note 时间：O(index - 游标索引)，顺序访问时均摊O(1), 空间：O(1)
+         * @{
+         */
+        Node* locate(int index, NodeBase*& prev) noexcept {
+                const NodeBase* constPrev = nullptr;
+                Node* curr = const_cast<Node*>(static_cast<const LinkedList*>(this) -> locate(index, constPrev));
+                prev = const_cast<NodeBase*>(constPrev);
+                if(_cursor != nullptr && curr != nullptr) {
+                        _cursor -> _node = curr;
+                        _cursor -> _prev = prev;
+                        _cursor -> _index = index;
+                }
+                return curr;
+        }
+        const Node* locate(int index, const NodeBase*& prev) const noexcept {
+                const NodeBase* before = &_beforeHead;
+                const Node* curr = _beforeHead._next;
+                int i = 0;
+                if(_cursor != nullptr && _cursor -> _node != nullptr && _cursor -> _index <= index) {
+                        before = _cursor -> _prev;
+                        curr = _cursor -> _node;
+                        i = _cursor -> _index;
+                }
+                statsRecorder().on_walk(static_cast<std::size_t>(index - i));
+                for(; i < index; i++) {
+                        before = curr;
+                        curr = curr -> _next;
+                }
+                prev = before;
+                return curr;
+        }
+        /** @} */
+        /**
+         * @brief 获取索引处节点的前驱
+         *
+         * 链表内部自用函数，不做范围检查
+         * 索引类函数都先用它找到前驱，再交给 *_after 系列函数处理
+         * 借助locate()，按索引递增的顺序插入或删除时也不必每次从头寻找
+         *
+         * @param index 目标索引，0的前驱为&_beforeHead
+         * @return 前驱位置
+         * @note 时间：O(index)，顺序访问时均摊O(1), 空间：O(1)
+         */
+        NodeBase* nodeBefore(int index) noexcept {
+                NodeBase* prev;
+                locate(index, prev);
+                return prev;
+        }
+        /**
+         * @brief 把游标恢复到索引处
+         *
+         * 链表内部自用函数
+         * 在index处插入或删除之后，index之前的元素不变，prev之后的节点就是新的index处的节点
+         *
+         * @param index 刚刚插入或删除的索引
+         * @param prev nodeBefore(index)的结果
+         */
+        void restoreCursor(int index, NodeBase* prev) noexcept {
+                if(_cursor != nullptr && prev -> _next != nullptr) {
+                        _cursor -> _node = prev -> _next;
+                        _cursor -> _prev = prev;
+                        _cursor -> _index = index;
+                }
+        }
+        /**
+         * @brief 摘下pos之后的节点
+         *
+         * 链表内部自用函数，pos之后必须有节点
+         * 只摘下，不销毁，负责维护_tail _length，并使游标失效
+         *
+         * @param pos 被摘下节点的前驱，可以是&_beforeHead
+         * @return 被摘下的节点
+         * @note 时间：O(1), 空间：O(1)
+         */
+        Node* unlinkAfter(NodeBase* pos) noexcept {
+                invalidateCursor();
+                Node* target = pos -> _next;
+                pos -> _next = target -> _next;
+                if(target == _tail) {
+                        _tail = tailFrom(pos);
+                }
+                _length--;
+                return target;
+        }
+        /**
+         * @brief 分配器不相等时的merge()
+         *
+         * 链表内部自用函数
+         * 逐个把other的元素移动到此链表的新节点中
+         * comp或构造抛出异常时，已合并的元素留在此链表中，其余留在other中
+         *
+         * @param other 被合并的链表，随后为空
+         * @param comp 严格弱序比较
+         * @note 时间：O(n + m), 空间：O(1)
+         */
+        template<typename Compare>
+        void mergeByMove(LinkedList& other, Compare& comp) {
+                NodeBase* prev = &_beforeHead;
+                while(prev -> _next != nullptr && !other.empty()) {
+                        if(comp(other._beforeHead._next -> _data, prev -> _next -> _data)) {
+                                moveNodeAfter(prev, other, &other._beforeHead);
+                        }
+                        prev = prev -> _next;
+                }
+                while(!other.empty()) {
+                        prev = moveNodeAfter(prev, other, &other._beforeHead);
+                }
+        }
+        /**
+         * @brief 合并两段有序的节点
+         *
+         * 链表内部自用函数，sort()的一部分
+         * 两段都以 nullptr 结尾
+         * 稳定：相等时(head, tail)中的节点在前
+         * comp抛出异常时，(head, tail)是包含两段全部节点的一段(顺序未指定)
+         *
+         * @param head 第一段的首节点，合并后为结果的首节点
+         * @param tail 第一段的尾节点，合并后为结果的尾节点
+         * @param other 第二段的首节点
+         * @param otherTail 第二段的尾节点
+         * @param comp 严格弱序比较
+         * @note 时间：O(两段长度之和), 空间：O(1)
+         */
+        template<typename Compare>
+        static void mergeRuns(Node*& head, Node*& tail, Node* other, Node* otherTail, Compare& comp) {
+                NodeBase merged;
+                NodeBase* last = &merged;
+                Node* first = head;
+                try {
+                        while(first != nullptr && other != nullptr) {
+                                if(comp(other -> _data, first -> _data)) {
+                                        last -> _next = other;
+                                        other = other -> _next;
+                                } else {
+                                        last -> _next = first;
+                                        first = first -> _next;
+                                }
+                                last = last -> _next;
+                        }
+                } catch(...) {
+                        last -> _next = first;
+                        tail -> _next = other;
+                        head = merged._next;
+                        tail = otherTail;
+                        throw;
+                }
+                if(first != nullptr) {
+                        last -> _next = first;
+                } else {
+                        last -> _next = other;
+                        tail = otherTail;
+                }
+                head = merged._next;
+        }
+        /**
+         * @brief 在指定位置构造新元素
+         *
+         * 链表内部自用函数，insert()的实现
+         * 先检查索引，再创建节点，索引非法时不会分配内存
+         *
+         * @param index 要插入的位置
+         * @param args 转发给createNode()的参数
+         * @note 时间：O(n), 空间：O(1)
+         */
+        template<typename... Args>
+        void emplaceAt(int index, Args&&... args) {
+                statsRecorder().on_operation(ListOperation::Insert);
+                if(index < 0 || index > _length) {
+                        throw std::out_of_range("index out of range");
+                } else if(index == 0) {
+                        linkFront(createNode(std::forward<Args>(args)...));
+                        return;
+                } else if (index == _length) {
+                        linkBack(createNode(std::forward<Args>(args)...));
+                        return;
+                }
+                Node* newNode = createNode(std::forward<Args>(args)...);
+                NodeBase* prev = nodeBefore(index);
+                linkAfter(prev, newNode);
+                restoreCursor(index, prev);
+        }
+        /**
+         * @name 为批量插入预留节点
+         * @brief 分配器提供reserve(n)时调用它，否则什么也不做
+         *
+         * 链表内部自用函数
+         * 节点需要逐个释放，所以不能用一次allocate(n)分配整批节点
+         * PoolAllocator的reserve()一次申请能容纳n个节点的大块，之后的n次分配都不再访问系统堆
+         * 批量插入结束或失败后用unreserveNodes()结束预留，分配器提供unreserve()时调用它
+         *
+         * @param count 将要创建的节点数
+         * @{
+         */
+        template<typename Alloc>
+        static auto reserveNodes(Alloc& alloc, std::size_t count, int) -> decltype(alloc.reserve(count), void()) {
+                alloc.reserve(count);
+        }
+        template<typename Alloc>
+        static void reserveNodes(Alloc&, std::size_t, long) noexcept {}
+        template<typename Alloc>
+        static auto unreserveNodes(Alloc& alloc, int) noexcept -> decltype(alloc.unreserve(), void()) {
+                alloc.unreserve();
+        }
+        template<typename Alloc>
+        static void unreserveNodes(Alloc&, long) noexcept {}
+        template<typename Alloc>
+        static auto canReserve(Alloc& alloc, int) -> decltype(alloc.reserve(std::size_t()), std::true_type());
+        template<typename Alloc>
+        static std::false_type canReserve(Alloc&, long);
+        using CanReserve = decltype(canReserve(std::declval<NodeAllocator&>(), 0)); ///< 分配器是否提供reserve()
+        /** @} */
+        /**
+         * @name 一次性释放全部节点
+         * @brief 分配器提供release_all()时调用它，否则返回false
+         *
+         * 链表内部自用函数，clean()的快速路径
+         * PoolAllocator只在独占整组池时才真正释放，否则也返回false
+         *
+         * @return 是否已释放
+         * @{
+         */
+        template<typename Alloc>
+        static auto releaseAllNodes(Alloc& alloc, int) -> decltype(bool(alloc.release_all())) {
+                return alloc.release_all();
+        }
+        template<typename Alloc>
+        static bool releaseAllNodes(Alloc&, long) noexcept {
+                return false;
+        }
+        /** @} */
+        /**
+         * @name 计算迭代器范围的长度
+         * @brief 只在可以预留节点时才计算
+         *
+         * 链表内部自用函数
+         * 单趟迭代器(input iterator)只能遍历一次，无法预先计算，返回0
+         *
+         * @return 范围的长度，无法或无需计算时为0
+         * @{
+         */
+        template<typename InputIt>
+        static std::size_t rangeSize(InputIt first, InputIt last, std::true_type) {
+                return forwardDistance(first, last, typename std::iterator_traits<InputIt>::iterator_category());
+        }
+        template<typename InputIt>
+        static std::size_t rangeSize(InputIt, InputIt, std::false_type) noexcept {
+                return 0;
+        }
+        template<typename InputIt>
+        static std::size_t forwardDistance(InputIt first, InputIt last, std::forward_iterator_tag) {
+                return static_cast<std::size_t>(std::distance(first, last));
+        }
+        template<typename InputIt>
+        static std::size_t forwardDistance(InputIt, InputIt, std::input_iterator_tag) noexcept {
+                return 0;
+        }
+        /** @} */
+        /**
+         * @brief 在尾部追加一个范围内的全部元素
+         *
+         * 链表内部自用函数，批量插入的实现
+         * 先按count预留节点，再把新节点串成一条独立的链，最后一次性接到尾部
+         * 构造抛出异常时销毁已创建的节点，链表不变(强异常保证)
+         *
+         * @param first 范围起点
+         * @param last 范围终点，类型可以与first不同(C++20的哨兵)
+         * @param count 范围的长度，未知时为0
+         * @note 时间：O(n), 空间：O(1)
+         */
+        template<typename InputIt, typename Sentinel>
+        void appendRange(InputIt first, Sentinel last, std::size_t count) {
+                if(count != 0) {
+                        reserveNodes(_alloc, count, 0);
+                }
+                NodeBase chain;
+                NodeBase* chainTail = &chain;
+                int added = 0;
+                try {
+                        for(; first != last; ++first) {
+                                Node* newNode = createNode(EmplaceTag(), *first);
+                                chainTail -> _next = newNode;
+                                chainTail = newNode;
+                                added++;
+                        }
+                } catch(...) {
+                        chainTail -> _next = nullptr;
+                        while(chain._next != nullptr) {
+                                Node* temp = chain._next;
+                                chain._next = temp -> _next;
+                                destroyNode(temp);
+                        }
+                        unreserveNodes(_alloc, 0);
+                        throw;
+                }
+                unreserveNodes(_alloc, 0);
+                if(added == 0) {
+                        return;
+                }
+                chainTail -> _next = nullptr;
+                _tail == nullptr? _beforeHead._next = chain._next: _tail -> _next = chain._next;
+                _tail = static_cast<Node*>(chainTail);
+                _length += added;
+                statsRecorder().on_length(_length);
+        }
+        /**
+         * @brief 用一个范围的全部元素替换链表内容
+         *
+         * 链表内部自用函数，assign()的实现
+         * 先在临时链表中建好新内容，成功后才销毁旧内容(强异常保证)
+         * 临时链表使用此链表分配器的副本，两者相等，可以直接接管节点
+         *
+         * @param first 范围起点
+         * @param last 范围终点
+         * @param count 范围的长度，未知时为0
+         * @note 时间：O(n + 原长度), 空间：O(n)
+         */
+        template<typename InputIt, typename Sentinel>
+        void assignRange(InputIt first, Sentinel last, std::size_t count) {
+                LinkedList temp(get_allocator());
+                temp.appendRange(first, last, count);
+                clean();
+                stealNodes(temp);
+                statsRecorder().absorb(temp.statsRecorder());
+        }
+        /**
+         * @brief 寻找最后一个节点
+         *
+         * 链表内部自用函数
+         * 是异常安全的，不修改链表
+         * 直接返回维护好的_tail，无需遍历
+         *
+         * @return 链表最后一个节点的指针
+         * @note 时间：O(1), 空间：O(1)
+         */
+        Node* lastNodePtr() const noexcept{
+                return _tail;
+        }
+        /**
+         * @brief 在删除之前进行检查
+         *
+         * 使用empty()检查是链表是否为空
+         * 如果链表为空，则抛出异常
+         *
+         * @sa empty()
+         */
+        void checkNotEmpty() const {
+                if(empty()) {
+                        throw std::logic_error("cannot pop from empty list");
+                }
+        }
+public:
+        using allocator_type = Allocator; ///< 对接STL
+        /**
+         * @name 链表构造函数
+         * @brief 对链表进行初始化
+         * @{
+         */
+         
+         /**
+          * @brief 无参构造函数
+          *
+          * _beforeHead._next初始化为 nullptr
+          * _tail初始化为 nullptr
+          * _length初始化为 0
+          * _alloc默认构造
+          *
+          */
+        LinkedList() noexcept(std::is_nothrow_default_constructible<NodeAllocator>::value):
+                _beforeHead(), _tail(nullptr), _cursor(nullptr), _length(0), _alloc() {}
+        /**
+         * @brief 指定分配器的构造函数
+         *
+         * _alloc由传入的分配器重绑定得到
+         * 其余成员同无参构造函数
+         *
+         * @param alloc 要使用的分配器
+         */
+        explicit LinkedList(const Allocator& alloc):
+                _beforeHead(), _tail(nullptr), _cursor(nullptr), _length(0), _alloc(alloc) {}
+        /**
+         * @brief 拷贝构造函数
+         *
+         * _beforeHead._next 先 初始化为 nullptr
+         * _tail 先 初始化为 nullptr
+         * _length 先 初始化为 0
+         * _alloc 由 select_on_container_copy_construction 得到
+         * 长度已知，分配器支持时一次预留全部节点
+         *
+         * @sa appendRange()
+         * @param other 拷贝给此链表的链表
+         * @note 时间：O(n), 空间：O(1)
+         */
+        LinkedList(const LinkedList& other):
+                _beforeHead(), _tail(nullptr), _cursor(nullptr), _length(0),
+                _alloc(NodeAllocTraits::select_on_container_copy_construction(other._alloc)) {
+                appendRange(other.cbegin(), other.cend(), static_cast<std::size_t>(other._length));
+        }
+        /**
+         * @brief 迭代器范围构造函数
+         *
+         * 依次拷贝[first, last)中的元素
+         * 前向迭代器且分配器支持时一次预留全部节点
+         * 构造抛出异常时已创建的节点全部销毁
+         *
+         * @sa appendRange()
+         * @param first 范围起点
+         * @param last 范围终点
+         * @param alloc 要使用的分配器
+         * @note 时间：O(n), 空间：O(1)
+         */
+        template<typename InputIt, typename = typename std::enable_if<!std::is_integral<InputIt>::value>::type>
+        LinkedList(InputIt first, InputIt last, const Allocator& alloc = Allocator()):
+                _beforeHead(), _tail(nullptr), _cursor(nullptr), _length(0), _alloc(alloc) {
+                appendRange(first, last, rangeSize(first, last, CanReserve()));
+        }
+        /**
+         * @brief 初始化列表构造函数
+         *
+         * @code
+         * LinkedList<int> l{1, 2, 3};
+         * @endcode
+         *
+         * @param init 初始元素
+         * @param alloc 要使用的分配器
+         * @note 时间：O(n), 空间：O(1)
+         */
+        LinkedList(std::initializer_list<DataType> init, const Allocator& alloc = Allocator()):
+                _beforeHead(), _tail(nullptr), _cursor(nullptr), _length(0), _alloc(alloc) {
+                appendRange(init.begin(), init.end(), init.size());
+        }
+        /**
+         * @brief 赋值构造函数
+         *
+         * @param other 赋值给次链表的链表
+         * @return 当前链表
+         * @note 时间：O(n), 空间：O(1)
+         */
+        LinkedList& operator=(const LinkedList& other) {
+                if(this == &other) {
+                        return *this;
+                }
+                const bool propagate = NodeAllocTraits::propagate_on_container_copy_assignment::value;
+                LinkedList temp(allocator_type(propagate? other._alloc: _alloc));
+                temp.appendRange(other.cbegin(), other.cend(), static_cast<std::size_t>(other._length));
+                clean();
+                copyAllocatorFrom(other, typename NodeAllocTraits::propagate_on_container_copy_assignment());
+                stealNodes(temp);
+                statsRecorder().absorb(temp.statsRecorder());
+                return *this;
+        }
+        /**
+         * @brief 初始化列表赋值
+         *
+         * @sa assign()
+         * @param init 新的元素
+         * @return 当前链表
+         * @note 时间：O(n), 空间：O(n)
+         */
+        LinkedList& operator=(std::initializer_list<DataType> init) {
+                assign(init);
+                return *this;
+        }
+        /**
+         * @brief 移动构造函数
+         *
+         * _beforeHead._next初始化为传入对象的_beforeHead._next
+         * _tail初始化为传入对象的_tail
+         * _length初始化为传入对象的_length
+         * _alloc由传入对象的_alloc移动构造
+         *
+         * @param other 被接受的对象
+         * @note 被用作此对象初始化的对象将被置空
+         * @note 时间：O(1), 空间：O(1)
+         */
+        LinkedList(LinkedList&& other) noexcept:
+                _beforeHead(), _tail(nullptr), _cursor(nullptr), _length(0), _alloc(std::move(other._alloc)) {
+                stealNodes(other);
+        }
+        /**
+         * @brief 指定分配器的移动构造函数
+         *
+         * alloc与other的分配器相等时直接接管节点
+         * 否则无法互相释放节点，逐个把元素移动到新节点中，other随后清空
+         *
+         * @param other 被移动的链表
+         * @param alloc 要使用的分配器
+         * @note 时间：O(1)；分配器不相等时 O(n), 空间：O(1)
+         */
+        LinkedList(LinkedList&& other, const Allocator& alloc):
+                _beforeHead(), _tail(nullptr), _cursor(nullptr), _length(0), _alloc(alloc) {
+                if(_alloc == other._alloc) {
+                        stealNodes(other);
+                        return;
+                }
+                appendRange(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()),
+                        static_cast<std::size_t>(other._length));
+                other.clean();
+        }
+        /**
+         * @brief 移动赋值构造函数
+         *
+         * _beforeHead._next初始化为传入对象的_beforeHead._next
+         * _tail初始化为传入对象的_tail
+         * _length初始化为传入对象的_length
+         * 分配器不传播且两者不相等时，无法直接接管节点
+         * 此时退化为逐个移动元素
+         *
+         * @param other 被接受的对象
+         * @return 自己
+         * @note 被用作此对象初始化的对象将被置空
+         * @note 时间：O(1), 空间：O(1)；退化时 时间：O(n)
+         */
+        LinkedList& operator=(LinkedList&& other)
+                        noexcept(NodeAllocTraits::propagate_on_container_move_assignment::value) {
+                if(this == &other) {
+                        return *this;
+                }
+                clean();
+                if(NodeAllocTraits::propagate_on_container_move_assignment::value || _alloc == other._alloc) {
+                        moveAllocatorFrom(other, typename NodeAllocTraits::propagate_on_container_move_assignment());
+                        stealNodes(other);
+                        return *this;
+                }
+                for(auto curr = other._beforeHead._next; curr != nullptr; curr = curr -> _next) {
+                        push_back(std::move(curr -> _data));
+                }
+                other.clean();
+                return *this;
+        }
+        /** @} */
+        
+        /**
+         * @brief 析构函数
+         *
+         * 调用clean()函数删除链表，再释放游标
+         *
+         * @sa clean()
+         * @note 时间：O(n), 空间：O(1)
+         */
+        ~LinkedList() noexcept {
+                clean();
+                delete _cursor;
+        }
+        
+        /**
+         * @brief 获取分配器
+         *
+         * @return 由_alloc重绑定回DataType得到的分配器副本
+         */
+        allocator_type get_allocator() const {
+                return allocator_type(_alloc);
+        }
+        /**
+         * @brief 获取统计
+         *
+         * 返回的副本中填入了当前长度和节点大小
+         * Stats为NoListStats时是一个空对象
+         *
+         * @sa ListStats.hpp
+         * @return 统计的副本
+         */
+        Stats stats() const {
+                Stats result(statsRecorder());
+                result.on_snapshot(_length, sizeof(Node));
+                return result;
+        }
+        /**
+         * @brief 清零统计
+         *
+         * 峰值长度从当前长度重新开始
+         *
+         */
+        void reset_stats() {
+                statsRecorder() = Stats();
+                statsRecorder().on_length(_length);
+        }
+        
+        class ConstIterator;
+        /**
+         * @class Iterator
+         * @brief LinkedList的内置迭代器
+         *
+         * 部分未做nullptr检查
+         * 出于性能考虑
+         *
+         */
+        class Iterator {
+        private:
+                NodeBase* _curr;///< 迭代器当前指向的节点，before_begin()时指向_beforeHead
+                friend class LinkedList;///< 使LinkedList能访问Iterator私有成员
+                friend class ConstIterator;///< 使ConstIterator能从Iterator构造
+        public:
+                /**
+                 * @brief 对接STL
+                 * @{
+                 */
+                using iterator_category = std::forward_iterator_tag; ///< 此为单向链表
+                using value_type = DataType; ///< 数据类型为DataType
+                using difference_type = std::ptrdiff_t; ///< 此为距离类型
+                using pointer = DataType*; ///< 指针类型
+                using reference = DataType&; ///< 解引用时返回DataType&
+                /** @} */
+                
+                /**
+                 * @brief 构造函数
+                 *
+                 * 初始化成员，默认初始化为 nullptr
+                 * 异常安全
+                 *
+                 */
+                explicit Iterator(NodeBase* ptr = nullptr) noexcept: _curr(ptr){}
+                /**
+                 * @brief 迭代器解引用
+                 *
+                 * 不修改链表,异常安全
+                 *
+                 * @return 迭代器指向的数据的引用
+                 */
+                DataType& operator*() const noexcept {
+                        return static_cast<Node*>(_curr) -> _data;
+                }
+                /**
+                 * @brief 迭代器箭头运算符
+                 *
+                 * 不修改链表,异常安全
+                 *
+                 * @return 迭代器指向的数据的指针
+                 */
+                DataType* operator->() const noexcept {
+                        return &(static_cast<Node*>(_curr) -> _data);
+                }
+                /**
+                 * @brief 前置递增
+                 *
+                 * 异常安全
+                 * 启用预取时顺便预取下一个节点
+                 *
+                 */
+                Iterator& operator++() noexcept {
+                        _curr = _curr -> _next;
+                        if(LINKEDLIST_PREFETCH_DISTANCE > 0 && _curr != nullptr && _curr -> _next != nullptr) {
+                                prefetchNode(_curr -> _next);
+                        }
+                        return *this;
+                }
+                /**
+                 * @brief 后置递增
+                 *
+                 * 异常安全
+                 *
+                 * @param int 无用，做重载区分
+                 */
+                Iterator operator++(int) noexcept {
+                        auto temp = *this;
+                        _curr = _curr -> _next;
+                        if(LINKEDLIST_PREFETCH_DISTANCE > 0 && _curr != nullptr && _curr -> _next != nullptr) {
+                                prefetchNode(_curr -> _next);
+                        }
+                        return temp;
+                }
+                /**
+                 * @brief ==比较重载
+                 *
+                 * 不修改链表,异常安全
+                 *
+                 */
+                bool operator==(const Iterator& other) const noexcept {
+                        return _curr == other._curr;
+                }
+                /**
+                 * @brief !=比较重载
+                 *
+                 * 基于迭代器的==重载
+                 * 不修改链表,异常安全
+                 *
+                 * @sa operator==
+                 */
+                bool operator!=(const Iterator& other) const noexcept {
+                        return !(*this == other);
+                }
+        }; ///< class Iterator
+        
+        /**
+         * @class ConstIterator
+         * @brief LinkedList的内置Const迭代器
+         *
+         * 部分未做nullptr检查
+         * 出于性能考虑
+         * 对比Iterator,主要修改在operator*()和operator->()
+         * 是Iterator的const版
+         *
+         * @see Iterator
+         */
+        class ConstIterator {
+        private:
+                const NodeBase* _curr;///< 迭代器当前指向的节点，before_begin()时指向_beforeHead
                 friend class LinkedList;///< 使LinkedList能访问Iterator私有成员
         public:
                 /**
@@ -331,7 +1236,15 @@ public:
                  * 异常安全
                  *
                  */
-                explicit ConstIterator(const Node* ptr = nullptr) noexcept: _curr(ptr){}
+                explicit ConstIterator(const NodeBase* ptr = nullptr) noexcept: _curr(ptr){}
+                /**
+                 * @brief 从Iterator转换
+                 *
+                 * 允许在需要ConstIterator的地方直接传入Iterator
+                 * 异常安全
+                 *
+                 */
+                ConstIterator(const Iterator& it) noexcept: _curr(it._curr){}
                 /**
                  * @brief 迭代器解引用
                  *
@@ -340,7 +1253,7 @@ public:
                  * @return 迭代器指向的数据的常量引用
                  */
                 const DataType& operator*() const noexcept {
-                        return _curr -> _data;
+                        return static_cast<const Node*>(_curr) -> _data;
                 }
                 /**
                  * @brief 迭代器箭头运算符
@@ -350,16 +1263,20 @@ public:
                  * @return 迭代器指向的数据的常量指针
                  */
                 const DataType* operator->() const noexcept {
-                        return &(_curr -> _data);
+                        return &(static_cast<const Node*>(_curr) -> _data);
                 }
                 /**
                  * @brief 前置递增
                  *
                  * 异常安全
+                 * 启用预取时顺便预取下一个节点
                  *
                  */
                 ConstIterator& operator++() noexcept {
                         _curr = _curr -> _next;
+                        if(LINKEDLIST_PREFETCH_DISTANCE > 0 && _curr != nullptr && _curr -> _next != nullptr) {
+                                prefetchNode(_curr -> _next);
+                        }
                         return *this;
                 }
                 /**
@@ -372,6 +1289,9 @@ public:
                 ConstIterator operator++(int) noexcept {
                         auto temp = *this;
                         _curr = _curr -> _next;
+                        if(LINKEDLIST_PREFETCH_DISTANCE > 0 && _curr != nullptr && _curr -> _next != nullptr) {
+                                prefetchNode(_curr -> _next);
+                        }
                         return temp;
                 }
                 /**
@@ -394,464 +1314,1327 @@ public:
                 bool operator!=(const ConstIterator& other) const noexcept {
                         return !(*this == other);
                 }
-        }; ///< class ConstIterator
-        
+        }; ///< class ConstIterator
+        
+        /**
+         * @name 获取首元素之前的迭代器
+         * @brief 返回指向_beforeHead的迭代器
+         *
+         * 不能解引用，只能作为 *_after 系列函数的位置参数
+         * 或者递增得到begin()
+         *
+         * @return 指向_beforeHead的迭代器
+         * @{
+         */
+        Iterator before_begin() noexcept {
+                return Iterator(&_beforeHead);
+        }
+        ConstIterator before_begin() const noexcept {
+                return ConstIterator(&_beforeHead);
+        }
+        ConstIterator cbefore_begin() const noexcept {
+                return ConstIterator(&_beforeHead);
+        }
+        /** @} */
+        
+        /**
+         * @brief 获取首迭代器
+         *
+         * 用LinkedList的首节点初始化一个匿名Iterator对象并返回
+         * 使用了Iterator的构造函数
+         *
+         * @sa Iterator()
+         * @return 用LinkedList的首节点初始化的匿名Iterator对象
+         */
+        Iterator begin() {
+                return Iterator(_beforeHead._next);
+        }
+        /**
+         * @brief 获取尾迭代器的后一位置
+         *
+         * 用nullptr初始化一个匿名Iterator对象并返回
+         * 但其实Iterator构造函数的默认值就是nullptr
+         * 使用了Iterator的构造函数
+         *
+         * @sa Iterator()
+         * @return 用nullptr初始化的匿名Iterator对象
+         */
+        Iterator end() {
+                return Iterator(nullptr);
+        }
+        /**
+         * @name ConstIterator的begin
+         * @brief 分为两个版本
+         *
+         * 主要分为了 begin() - 与普通Iterator同名
+         * 和  cbegin() - 显示强调Const版本
+         *
+         * @{
+         */
+         
+         /**
+         * @brief 获取首迭代器
+         *
+         * 用LinkedList的首节点初始化一个匿名ConstIterator对象并返回
+         * 使用了ConstIterator的构造函数
+         *
+         * @sa ConstIterator()
+         * @return 用LinkedList的首节点初始化的匿名ConstIterator对象
+         */
+        ConstIterator begin() const {
+               return ConstIterator(_beforeHead._next);
+        }
+        
+        /**
+        * @brief 获取首迭代器 -强调const版
+        *
+        * 用LinkedList的首节点初始化一个匿名ConstIterator对象并返回
+        * 使用了ConstIterator的构造函数
+        *
+        * @sa ConstIterator()
+        * @return 用LinkedList的首节点初始化的匿名ConstIterator对象
+        */
+        ConstIterator cbegin() const {
+               return ConstIterator(_beforeHead._next);
+        }
+        /** @} */
+        
+        /**
+        * @name ConstIterator的end
+        * @brief 分为两个版本
+        *
+        * 主要分为了 end() - 与普通Iterator同名
+        * 和  cend() - 显示强调Const版本
+        *
+        * @{
+        */
+        
+        /**
+        * @brief 获取尾迭代器的后一位置
+        *
+        * 用nullptr初始化一个匿名ConstIterator对象并返回
+        * 但其实ConstIterator构造函数的默认值就是nullptr
+        * 使用了ConstIterator的构造函数
+        *
+        * @sa ConstIterator()
+        * @return 用nullptr初始化的匿名ConstIterator对象
+        */
+        ConstIterator end() const {
+               return ConstIterator(nullptr);
+        }
+        /**
+        * @brief 获取尾迭代器的后一位置 -强调const版
+        *
+        * 用nullptr初始化一个匿名ConstIterator对象并返回
+        * 但其实ConstIterator构造函数的默认值就是nullptr
+        * 使用了ConstIterator的构造函数
+        *
+        * @sa ConstIterator()
+        * @return 用nullptr初始化的匿名ConstIterator对象
+        */
+        ConstIterator cend() const {
+               return ConstIterator(nullptr);
+        }
+        
+        /** @} */
+        
+        /**
+         * @name 下标访问
+         * @brief 提供[]的下标访问
+         *
+         * 重载了const和非const两个版本
+         * 在所索引超出范围时抛出异常
+         *
+         * @param index 目标索引
+         * @return 所存储的数据类型
+         * @note 时间：O(n), 空间：O(1)
+         * @{
+         */
+         
+         /**
+          * @brief 非const版本
+          */
+        DataType& operator[](const int& index) {
+                statsRecorder().on_operation(ListOperation::Access);
+                if(index < 0 || index >= _length) {
+                   throw std::out_of_range("index out of range");
+                }
+                NodeBase* prev;
+                return locate(index, prev) -> _data;
+        }
+        /**
+          * @brief const版本
+          */
+        const DataType& operator[](const int& index) const {
+                statsRecorder().on_operation(ListOperation::Access);
+                if(index < 0 || index >= _length) {
+                   throw std::out_of_range("index out of range");
+                }
+                const NodeBase* prev;
+                return locate(index, prev) -> _data;
+        }
+        /** @} */
+        /**
+         * @brief 开启或关闭下标访问的游标
+         *
+         * 默认关闭：不分配游标，按索引访问、插入、删除都从头寻找，operator[]不修改链表对象，
+         * 与标准容器一样，多个线程可以同时对同一链表调用operator[]
+         * 开启时分配游标，非const的operator[]和按索引插入、删除把访问到的位置记入游标，
+         * for(i = 0; i < size(); i++) l[i] 这样的循环每次访问均摊O(1)
+         * 关闭时释放游标
+         * 设置属于链表对象本身，不随拷贝、移动和赋值传递
+         *
+         * @warning 开启后非const的operator[]会修改链表对象，不再是线程安全的：
+         *          多个线程同时对同一链表调用非const的operator[]需要外部同步
+         *
+         * @param enable 是否开启
+         * @throw std::bad_alloc 开启时分配游标失败，链表不变
+         * @note 时间：O(1), 空间：O(1)
+         */
+        void enable_access_cursor(bool enable = true) {
+                if(enable && _cursor == nullptr) {
+                        _cursor = new Cursor();
+                } else if(!enable) {
+                        delete _cursor;
+                        _cursor = nullptr;
+                }
+        }
+        /**
+         * @brief 下标访问的游标是否开启
+         *
+         * @sa enable_access_cursor()
+         * @return 是否已分配游标
+         */
+        bool access_cursor_enabled() const noexcept {
+                return _cursor != nullptr;
+        }
+        
+        /**
+         * @brief 获取链表长度
+         *
+         * 不修改链表
+         * 异常安全
+         *
+         * @return _length成员
+         */
+        int size() const noexcept {
+                return _length;
+        }
+        /**
+         * @brief 获取链表长度
+         *
+         * 不修改链表
+         * 异常安全
+         *
+         * @return 链表是否为空
+         * @retval true 链表为空
+         * @retval false 反之
+         */
+        bool empty() const noexcept {
+                return _beforeHead._next == nullptr;
+        }
+        /**
+         * @brief 清空链表
+         *
+         * 异常安全
+         * DataType平凡析构且分配器能一次性归还全部内存时(独占池的PoolAllocator)
+         * 跳过逐个节点的析构和释放，直接归还整块内存
+         *
+         * @note 时间：O(n)；快速路径 O(大块数), 空间：O(1)
+         */
+        void clean() noexcept {
+                const bool released = std::is_trivially_destructible<DataType>::value
+                        && _beforeHead._next != nullptr && releaseAllNodes(_alloc, 0);
+                if(released) {
+                        statsRecorder().on_deallocate(static_cast<std::size_t>(_length));
+                } else {
+                        walk<LINKEDLIST_PREFETCH_DISTANCE>(_beforeHead._next, [this](Node* node) -> bool {
+                                destroyNode(node);
+                                return true;
+                        });
+                }
+                _beforeHead._next = nullptr;
+                _tail = nullptr;
+                _length = 0;
+                invalidateCursor();
+        }
+        /**
+         * @brief 在后台线程中清空链表
+         *
+         * 调用线程只摘下整条节点链，链表立即为空
+         * 节点的析构和释放交给 Pool::background() 的后台线程，元素的析构函数也在那里执行
+         * 分配器需要无状态(如 std::allocator)才能在其他线程中释放，否则(如PoolAllocator)退化为clean()
+         * 使用时需包含 ThreadPool.hpp
+         *
+         * @note 时间：O(1), 空间：O(1)
+         */
+        template<typename Pool = ThreadPool>
+        void clear_async() {
+                if(empty()) {
+                        return;
+                }
+                if(!std::is_empty<NodeAllocator>::value) {
+                        clean();
+                        return;
+                }
+                Node* head = _beforeHead._next;
+                NodeAllocator alloc(_alloc);
+                Pool::background().submit([head, alloc]() mutable {
+                        walk<LINKEDLIST_PREFETCH_DISTANCE>(head, [&alloc](Node* node) -> bool {
+                                NodeAllocTraits::destroy(alloc, node);
+                                NodeAllocTraits::deallocate(alloc, node, 1);
+                                return true;
+                        });
+                });
+                statsRecorder().on_deallocate(static_cast<std::size_t>(_length));
+                _beforeHead._next = nullptr;
+                _tail = nullptr;
+                _length = 0;
+                invalidateCursor();
+        }
+        /**
+         * @name 寻找是否有某个值
+         * @brief 分为三个版本
+         * @{
+         */
+        
+        /**
+         * @brief 返回int版本
+         *
+         * 不修改链表
+         *
+         * @param data 要寻找的数据
+         * @return int 目标值的索引
+         * @retval >=0 找到的索引
+         * @retval -1 未找到
+         * @note 时间：O(n), 空间：O(1)
+         */
+        int find_index(const DataType& data) const {
+                statsRecorder().on_operation(ListOperation::Find);
+                int index = 0;
+                const Node* found = walk<LINKEDLIST_PREFETCH_DISTANCE>(_beforeHead._next, [&](const Node* node) -> bool {
+                        if(node -> _data != data) {
+                                index++;
+                                return true;
+                        }
+                        return false;
+                });
+                return found == nullptr? -1: index;
+        }
+        /**
+         * @brief 返回Iterator版本
+         *
+         * 不修改链表
+         * 使用Iterator的begin() end()来确定范围
+         *
+         * @sa begin() end()
+         * @param data 要寻找的数据
+         * @return Iterator 目标值的迭代器
+         * @retval Iterator 找到的迭代器
+         * @retval end() 未找到
+         * @note 时间：O(n), 空间：O(1)
+         */
+        Iterator find(const DataType& data) {
+                statsRecorder().on_operation(ListOperation::Find);
+                for(auto it = begin(); it != end(); ++it) {
+                        if (*it == data) {
+                                return it;
+                        }
+                }
+                return end();
+        }
         /**
-         * @brief 获取首迭代器
+         * @brief 返回ConstIterator版本
          *
-         * 用LinkedList的首节点初始化一个匿名Iterator对象并返回
-         * 使用了Iterator的构造函数
+         * 不修改链表
+         * 使用ConstIterator的cbegin() cend()来确定范围
          *
-         * @sa Iterator()
-         * @return 用LinkedList的首节点初始化的匿名Iterator对象
+         * @sa cbegin() cend()
+         * @param data 要寻找的数据
+         * @return ConstIterator 目标值的迭代器
+         * @retval ConstIterator 找到的迭代器
+         * @retval cend() 未找到
+         * @note 时间：O(n), 空间：O(1)
          */
-        Iterator begin() {
-                return Iterator(_head);
+        ConstIterator find(const DataType& data) const {
+                statsRecorder().on_operation(ListOperation::Find);
+                for(auto it = cbegin(); it != cend(); ++it) {
+                        if (*it == data) {
+                                return it;
+                        }
+                }
+                return cend();
         }
+        /** @} */
         /**
-         * @brief 获取尾迭代器的后一位置
+         * @brief 统计等于data的元素个数
          *
-         * 用nullptr初始化一个匿名Iterator对象并返回
-         * 但其实Iterator构造函数的默认值就是nullptr
-         * 使用了Iterator的构造函数
+         * 每个节点只有一个元素，无法向量化
+         * 需要批量查找时可以改用UnrolledLinkedList，它的count()使用SimdSearch
          *
-         * @sa Iterator()
-         * @return 用nullptr初始化的匿名Iterator对象
+         * @param data 要统计的数据
+         * @return 个数
+         * @note 时间：O(n), 空间：O(1)
          */
-        Iterator end() {
-                return Iterator(nullptr);
+        int count(const DataType& data) const {
+                statsRecorder().on_operation(ListOperation::Find);
+                int result = 0;
+                walk<LINKEDLIST_PREFETCH_DISTANCE>(_beforeHead._next, [&](const Node* node) -> bool {
+                        if(node -> _data == data) {
+                                result++;
+                        }
+                        return true;
+                });
+                return result;
         }
         /**
-         * @name ConstIterator的begin
-         * @brief 分为两个版本
+         * @brief 是否含有等于data的元素
          *
-         * 主要分为了 begin() - 与普通Iterator同名
-         * 和  cbegin() - 显示强调Const版本
+         * @param data 要寻找的数据
+         * @retval true 含有
+         * @retval false 反之
+         * @note 时间：O(n), 空间：O(1)
+         */
+        bool contains(const DataType& data) const {
+                statsRecorder().on_operation(ListOperation::Find);
+                return walk<LINKEDLIST_PREFETCH_DISTANCE>(_beforeHead._next, [&](const Node* node) -> bool {
+                        return !(node -> _data == data);
+                }) != nullptr;
+        }
+        /**
+         * @name 对每个元素调用函数
+         * @brief 分为const和非const版本
+         *
+         * 与 std::for_each 相同，但走内部遍历，可以单独指定预取距离
+         * 例如 l.for_each<8>(f) 只在这次调用中预取
          *
+         * @tparam Distance 预取距离，默认为 LINKEDLIST_PREFETCH_DISTANCE
+         * @param f 接受元素引用的函数
+         * @return f
+         * @note 时间：O(n), 空间：O(1)
          * @{
          */
-         
-         /**
-         * @brief 获取首迭代器
+        template<int Distance = LINKEDLIST_PREFETCH_DISTANCE, typename Function>
+        Function for_each(Function f) {
+                walk<Distance>(_beforeHead._next, [&](Node* node) -> bool {
+                        f(node -> _data);
+                        return true;
+                });
+                return f;
+        }
+        template<int Distance = LINKEDLIST_PREFETCH_DISTANCE, typename Function>
+        Function for_each(Function f) const {
+                walk<Distance>(_beforeHead._next, [&](const Node* node) -> bool {
+                        f(node -> _data);
+                        return true;
+                });
+                return f;
+        }
+        /** @} */
+        /**
+         * @name 累积
+         * @brief 与 std::accumulate 相同，依次计算 init = op(init, 元素)
          *
-         * 用LinkedList的首节点初始化一个匿名ConstIterator对象并返回
-         * 使用了ConstIterator的构造函数
+         * 不指定op时使用 operator+
          *
-         * @sa ConstIterator()
-         * @return 用LinkedList的首节点初始化的匿名ConstIterator对象
+         * @tparam Distance 预取距离，默认为 LINKEDLIST_PREFETCH_DISTANCE
+         * @param init 初始值
+         * @param op 二元函数
+         * @return 累积结果
+         * @note 时间：O(n), 空间：O(1)
+         * @{
          */
-        ConstIterator begin() const {
-               return ConstIterator(_head);
+        template<int Distance = LINKEDLIST_PREFETCH_DISTANCE, typename T, typename BinaryOp>
+        T accumulate(T init, BinaryOp op) const {
+                walk<Distance>(_beforeHead._next, [&](const Node* node) -> bool {
+                        init = op(std::move(init), node -> _data);
+                        return true;
+                });
+                return init;
         }
-        
-        /**
-        * @brief 获取首迭代器 -强调const版
-        *
-        * 用LinkedList的首节点初始化一个匿名ConstIterator对象并返回
-        * 使用了ConstIterator的构造函数
-        *
-        * @sa ConstIterator()
-        * @return 用LinkedList的首节点初始化的匿名ConstIterator对象
-        */
-        ConstIterator cbegin() const {
-               return ConstIterator(_head);
+        template<int Distance = LINKEDLIST_PREFETCH_DISTANCE, typename T>
+        T accumulate(T init) const {
+                walk<Distance>(_beforeHead._next, [&](const Node* node) -> bool {
+                        init = std::move(init) + node -> _data;
+                        return true;
+                });
+                return init;
         }
         /** @} */
         
         /**
-        * @name ConstIterator的end
-        * @brief 分为两个版本
-        *
-        * 主要分为了 end() - 与普通Iterator同名
-        * 和  cend() - 显示强调Const版本
-        *
-        * @{
-        */
-        
-        /**
-        * @brief 获取尾迭代器的后一位置
-        *
-        * 用nullptr初始化一个匿名ConstIterator对象并返回
-        * 但其实ConstIterator构造函数的默认值就是nullptr
-        * 使用了ConstIterator的构造函数
-        *
-        * @sa ConstIterator()
-        * @return 用nullptr初始化的匿名ConstIterator对象
-        */
-        ConstIterator end() const {
-               return ConstIterator(nullptr);
+         * @name 获取头元素
+         * @brief返回头指针的数据
+         *
+         * 使用empty()检查链表是否为空
+         * 重载const和非const版本
+         * 链表为空会抛出异常
+         *
+         * @sa empty()
+         * @return 头指针数据
+         * @{
+         */
+         
+         /**
+          * @brief 非const版
+          */
+        DataType& front() {
+                if(empty()) {
+                        throw std::logic_error("LinkedList is empty");
+                }
+                return _beforeHead._next -> _data;
         }
         /**
-        * @brief 获取尾迭代器的后一位置 -强调const版
-        *
-        * 用nullptr初始化一个匿名ConstIterator对象并返回
-        * 但其实ConstIterator构造函数的默认值就是nullptr
-        * 使用了ConstIterator的构造函数
-        *
-        * @sa ConstIterator()
-        * @return 用nullptr初始化的匿名ConstIterator对象
-        */
-        ConstIterator cend() const {
-               return ConstIterator(nullptr);
+         * @brief const版
+         */
+        const DataType& front() const {
+                if(empty()) {
+                        throw std::logic_error("LinkedList is empty");
+                }
+                return _beforeHead._next -> _data;
         }
-        
         /** @} */
         
         /**
-         * @name 下标访问
-         * @brief 提供[]的下标访问
+         * @name 获取尾元素
+         * @brief返回尾指针的数据
          *
-         * 重载了const和非const两个版本
-         * 在所索引超出范围时抛出异常
+         * 使用empty()检查链表是否为空
+         * 使用lastNodePtr()获取尾指针
+         * 重载const和非const版本
+         * 链表为空会抛出异常
          *
-         * @param index 目标索引
-         * @return 所存储的数据类型
-         * @note 时间：O(n), 空间：O(1)
+         * @sa empty() lastNodePtr()
+         * @return 尾指针数据
+         * @note 时间：O(1), 空间：O(1)
          * @{
          */
          
          /**
-          * @brief 非const版本
+          * @brief 非const版
           */
-        DataType& operator[](const int& index) {
-                if(index < 0 || index >= _length) {
-                   throw std::out_of_range("index out of range");
-                }
-                auto curr = _head;
-                for(int i = 0; i < index; i++) {
-                        curr = curr -> _next;
+        DataType& back() {
+                if(empty()) {
+                        throw std::logic_error("LinkedList is empty");
                 }
-                return curr -> _data;
+                return lastNodePtr() -> _data;
         }
         /**
-          * @brief const版本
-          */
-        const DataType& operator[](const int& index) const {
-                if(index < 0 || index >= _length) {
-                   throw std::out_of_range("index out of range");
-                }
-                auto curr = _head;
-                for(int i = 0; i < index; i++) {
-                        curr = curr -> _next;
+         * @brief const版
+         */
+        const DataType& back() const {
+                if(empty()) {
+                        throw std::logic_error("LinkedList is empty");
                 }
-                return curr -> _data;
+                return lastNodePtr() -> _data;
         }
         /** @} */
         
         /**
-         * @brief 获取链表长度
+         * @name 头插入
+         * @brief 将新元素作为头元素
          *
-         * 不修改链表
-         * 异常安全
+         * 分为拷贝和移动两个版本
+         * 使用linkFront()接入节点
+         *
+         * @sa linkFront()
+         * @param data 要插入的数据
+         * @note 时间：O(1), 空间：O(1)
+         * @{
+         */
+        void push_front(const DataType& data) {
+                statsRecorder().on_operation(ListOperation::PushFront);
+                linkFront(createNode(data));
+        }
+        void push_front(DataType&& data) {
+                statsRecorder().on_operation(ListOperation::PushFront);
+                linkFront(createNode(std::move(data)));
+        }
+        /** @} */
+        /**
+         * @name 尾插入
+         * @brief 将新元素作为尾元素
+         *
+         * 分为拷贝和移动两个版本
+         * 使用linkBack()接入节点
+         *
+         * @sa linkBack()
+         * @param data 要插入的数据
+         * @note 时间：O(1), 空间：O(1)
+         * @{
+         */
+        void push_back(const DataType& data) {
+                statsRecorder().on_operation(ListOperation::PushBack);
+                linkBack(createNode(data));
+        }
+        void push_back(DataType&& data) {
+                statsRecorder().on_operation(ListOperation::PushBack);
+                linkBack(createNode(std::move(data)));
+        }
+        /** @} */
+        /**
+         * @name 指定位置插入
+         * @brief 在列表中插入新元素
+         *
+         * 插入后新元素的索引为index
+         * 当索引超出范围时抛出异常
+         * 分为拷贝和移动两个版本
+         *
+         * @sa emplaceAt()
+         * @param index 要插入的位置
+         * @param data 要插入的数据
+         * @note 时间：O(n), 空间：O(1)
+         * @{
+         */
+        void insert(int index, const DataType& data) {
+                emplaceAt(index, data);
+        }
+        void insert(int index, DataType&& data) {
+                emplaceAt(index, std::move(data));
+        }
+        /** @} */
+        /**
+         * @name 在指定位置之后插入
+         * @brief 直接在迭代器指向的节点之后插入，不从头遍历
+         *
+         * 分为拷贝和移动两个版本
+         * 构造抛出异常时链表不变
+         *
+         * @param pos 新元素插入在它的后面，可以是before_begin()
+         * @param data 要插入的数据
+         * @return 指向新元素的Iterator
+         * @note 时间：O(1), 空间：O(1)
+         * @{
+         */
+        Iterator insert_after(ConstIterator pos, const DataType& data) {
+                Node* newNode = createNode(data);
+                linkAfter(const_cast<NodeBase*>(pos._curr), newNode);
+                return Iterator(newNode);
+        }
+        Iterator insert_after(ConstIterator pos, DataType&& data) {
+                Node* newNode = createNode(std::move(data));
+                linkAfter(const_cast<NodeBase*>(pos._curr), newNode);
+                return Iterator(newNode);
+        }
+        /** @} */
+        /**
+         * @name 原地构造
+         * @brief 用传入的参数直接在节点中构造新元素
+         *
+         * 不产生临时的DataType，也没有额外的拷贝或移动
+         * 构造抛出异常时链表不变
+         *
+         * @param args 转发给DataType构造函数的参数
+         * @return 新元素的引用
+         * @note 时间：O(1), 空间：O(1)
+         * @{
+         */
+        
+        /**
+         * @brief 在头部构造
+         */
+        template<typename... Args>
+        DataType& emplace_front(Args&&... args) {
+                statsRecorder().on_operation(ListOperation::PushFront);
+                Node* newNode = createNode(EmplaceTag(), std::forward<Args>(args)...);
+                linkFront(newNode);
+                return newNode -> _data;
+        }
+        /**
+         * @brief 在尾部构造
+         */
+        template<typename... Args>
+        DataType& emplace_back(Args&&... args) {
+                statsRecorder().on_operation(ListOperation::PushBack);
+                Node* newNode = createNode(EmplaceTag(), std::forward<Args>(args)...);
+                linkBack(newNode);
+                return newNode -> _data;
+        }
+        /**
+         * @brief 在pos之后构造
+         *
+         * @param pos 新元素插入在它的后面，可以是before_begin()
+         * @return 指向新元素的Iterator
+         */
+        template<typename... Args>
+        Iterator emplace_after(ConstIterator pos, Args&&... args) {
+                Node* newNode = createNode(EmplaceTag(), std::forward<Args>(args)...);
+                linkAfter(const_cast<NodeBase*>(pos._curr), newNode);
+                return Iterator(newNode);
+        }
+        /** @} */
+        
+        /**
+         * @brief 头删除
+         *
+         * 删除头元素
+         * 使用checkNotEmpty()进行相关检查
          *
-         * @return _length成员
+         * @sa checkNotEmpty() erase_after()
+         * @note 时间：O(1), 空间：O(1)
          */
-        int size() const noexcept {
-                return _length;
+        void pop_front() {
+                statsRecorder().on_operation(ListOperation::PopFront);
+                checkNotEmpty();
+                erase_after(cbefore_begin());
         }
         /**
-         * @brief 获取链表长度
+         * @brief 尾删除
          *
-         * 不修改链表
-         * 异常安全
+         * 删除尾元素
+         * 使用checkNotEmpty()进行相关检查
+         * 单向链表需要从头找到尾元素的前驱
          *
-         * @return 链表是否为空
-         * @retval true 链表为空
-         * @retval false 反之
+         * @sa checkNotEmpty() erase_after()
+         * @note 时间：O(n), 空间：O(1)
          */
-        bool empty() const noexcept {
-                return _head == nullptr;
+        void pop_back() {
+                statsRecorder().on_operation(ListOperation::PopBack);
+                checkNotEmpty();
+                NodeBase* prev = nodeBefore(_length - 1);
+                erase_after(ConstIterator(prev));
+                restoreCursor(_length, prev);
         }
         /**
-         * @brief 清空链表
+         * @brief 删除指定元素
          *
-         * 异常安全
+         * 索引超出范围时抛出异常
+         * 链表为空时抛出异常
+         * 找到前驱后交给erase_after()删除
+         * 边遍历边删除时应直接使用erase_after()或remove_if()，避免每次从头寻找
          *
+         * @sa erase_after()
+         * @param index 要删除的元素的索引
          * @note 时间：O(n), 空间：O(1)
          */
-        void clean() noexcept {
-                while(_head != nullptr) {
-                        auto temp = _head;
-                        _head = _head -> _next;
-                        delete temp;
+        void erase(int index) {
+                statsRecorder().on_operation(ListOperation::Erase);
+                if(index < 0 || index >= _length) {
+                        throw std::out_of_range("index out of range");
+                } else if(empty()) {
+                        throw std::logic_error("cannot erase from empty list");
                 }
-                _head = nullptr;
-                _length = 0;
+                NodeBase* prev = nodeBefore(index);
+                erase_after(ConstIterator(prev));
+                restoreCursor(index, prev);
         }
         /**
-         * @name 寻找是否有某个值
-         * @brief 分为三个版本
+         * @name 删除指定位置之后的元素
+         * @brief 直接在迭代器指向的节点上操作，不从头遍历
+         *
+         * 指向被删除元素的迭代器失效，其他迭代器仍然有效
+         *
          * @{
          */
-        
+
         /**
-         * @brief 返回int版本
+         * @brief 单个元素版本
          *
-         * 不修改链表
-         * 使用empty()检查链表是否为空
+         * pos之后必须有元素
          *
-         * @sa empty()
-         * @param data 要寻找的数据
-         * @return int 目标值的索引
-         * @retval >=0 找到的索引
-         * @retval -1 未找到
-         * @note 时间：O(n), 空间：O(1)
+         * @param pos 被删除元素的前驱，可以是before_begin()
+         * @return 指向被删除元素之后的迭代器
+         * @note 时间：O(1), 空间：O(1)
          */
-        int find_index(const DataType& data) const {
-                if(empty()) {
-                        return -1;
-                }
-                auto curr = _head;
-                int index = 0;
-                while(curr -> _data != data) {
-                        if(curr -> _next == nullptr) {
-                                return -1;
-                        }
-                        curr = curr -> _next;
-                        index++;
+        Iterator erase_after(ConstIterator pos) noexcept {
+                auto prev = const_cast<NodeBase*>(pos._curr);
+                destroyNode(unlinkAfter(prev));
+                return Iterator(prev -> _next);
+        }
+        /**
+         * @brief 范围版本
+         *
+         * 删除(first, last)之间的元素，不含first和last
+         * last必须在first之后，或为end()
+         *
+         * @param first 被删除范围的前驱，可以是before_begin()
+         * @param last 被删除范围之后的位置
+         * @return last
+         * @note 时间：O(删除的元素数), 空间：O(1)
+         */
+        Iterator erase_after(ConstIterator first, ConstIterator last) noexcept {
+                auto prev = const_cast<NodeBase*>(first._curr);
+                while(prev -> _next != last._curr) {
+                        destroyNode(unlinkAfter(prev));
                 }
-                return index;
+                return Iterator(const_cast<NodeBase*>(last._curr));
         }
+        /** @} */
         /**
-         * @brief 返回Iterator版本
+         * @name 按条件删除
+         * @brief 一次遍历删除所有满足条件的元素
          *
-         * 不修改链表
-         * 使用Iterator的begin() end()来确定范围
+         * 保留下来的元素相对顺序不变
+         * 谓词或比较抛出异常时，已删除的元素不会恢复，链表仍然有效
          *
-         * @sa begin() end()
-         * @param data 要寻找的数据
-         * @return Iterator 目标值的迭代器
-         * @retval Iterator 找到的迭代器
-         * @retval end() 未找到
+         * @return 删除的元素个数
          * @note 时间：O(n), 空间：O(1)
+         * @{
          */
-        Iterator find(const DataType& data) {
-                for(auto it = begin(); it != end(); ++it) {
-                        if (*it == data) {
-                                return it;
+
+        /**
+         * @brief 删除所有等于value的元素
+         *
+         * value可以是链表中某个元素的引用：这个元素最后才销毁
+         *
+         * @param value 要删除的值
+         */
+        int remove(const DataType& value) {
+                int removed = 0;
+                Node* deferred = nullptr;
+                NodeBase* prev = &_beforeHead;
+                try {
+                        while(prev -> _next != nullptr) {
+                                if(prev -> _next -> _data == value) {
+                                        Node* target = unlinkAfter(prev);
+                                        if(&target -> _data == &value) {
+                                                deferred = target;
+                                        } else {
+                                                destroyNode(target);
+                                        }
+                                        removed++;
+                                } else {
+                                        prev = prev -> _next;
+                                }
+                        }
+                } catch(...) {
+                        if(deferred != nullptr) {
+                                destroyNode(deferred);
                         }
+                        throw;
                 }
-                return end();
+                if(deferred != nullptr) {
+                        destroyNode(deferred);
+                }
+                return removed;
         }
         /**
-         * @brief 返回ConstIterator版本
-         *
-         * 不修改链表
-         * 使用ConstIterator的cbegin() cend()来确定范围
+         * @brief 删除所有使pred返回true的元素
          *
-         * @sa cbegin() cend()
-         * @param data 要寻找的数据
-         * @return ConstIterator 目标值的迭代器
-         * @retval ConstIterator 找到的迭代器
-         * @retval cend() 未找到
-         * @note 时间：O(n), 空间：O(1)
+         * @param pred 一元谓词
          */
-        ConstIterator find(const DataType& data) const {
-                for(auto it = cbegin(); it != cend(); ++it) {
-                        if (*it == data) {
-                                return it;
+        template<typename Predicate>
+        int remove_if(Predicate pred) {
+                int removed = 0;
+                NodeBase* prev = &_beforeHead;
+                while(prev -> _next != nullptr) {
+                        if(pred(prev -> _next -> _data)) {
+                                destroyNode(unlinkAfter(prev));
+                                removed++;
+                        } else {
+                                prev = prev -> _next;
                         }
                 }
-                return cend();
+                return removed;
         }
         /** @} */
         
         /**
-         * @name 获取头元素
-         * @brief返回头指针的数据
+         * @name 拼接
+         * @brief 把other中的节点移动到pos之后
          *
-         * 使用empty()检查链表是否为空
-         * 重载const和非const版本
-         * 链表为空会抛出异常
+         * 只修改指针，不分配内存，也不拷贝或移动元素
+         * 指向被移动元素的迭代器仍然有效，但属于此链表
+         * 两个链表的分配器不相等时(如两个SmallLinkedList)不能互相释放对方的节点，
+         * 退化为逐个把元素移动到此链表的新节点中，指向被移动元素的迭代器失效，
+         * 抛出异常时已移动的元素留在此链表中，其余留在other中
          *
-         * @sa empty()
-         * @return 头指针数据
+         * @param pos 节点插入在它的后面，可以是before_begin()
+         * @param other 节点的来源，可以是此链表本身(整表版本除外)
          * @{
          */
          
-         /**
-          * @brief 非const版
-          */
-        DataType& front() {
-                if(empty()) {
-                        throw std::logic_error("LinkedList is empty");
+        /**
+         * @brief 整表版本
+         *
+         * other随后为空
+         *
+         * @note 时间：O(1)；分配器不相等时 O(m), 空间：O(1)
+         */
+        void splice_after(ConstIterator pos, LinkedList& other) noexcept(AllocAlwaysEqual::value) {
+                invalidateCursor();
+                other.invalidateCursor();
+                if(this == &other || other.empty()) {
+                        return;
+                }
+                auto prev = const_cast<NodeBase*>(pos._curr);
+                if(!(_alloc == other._alloc)) {
+                        while(!other.empty()) {
+                                prev = moveNodeAfter(prev, other, &other._beforeHead);
+                        }
+                        return;
                 }
-                return _head -> _data;
+                other._tail -> _next = prev -> _next;
+                prev -> _next = other._beforeHead._next;
+                if(other._tail -> _next == nullptr) {
+                        _tail = other._tail;
+                }
+                _length += other._length;
+                statsRecorder().on_length(_length);
+                other._beforeHead._next = nullptr;
+                other._tail = nullptr;
+                other._length = 0;
         }
         /**
-         * @brief const版
+         * @brief 整表版本 -右值
          */
-        const DataType& front() const {
-                if(empty()) {
-                        throw std::logic_error("LinkedList is empty");
+        void splice_after(ConstIterator pos, LinkedList&& other) noexcept(AllocAlwaysEqual::value) {
+                splice_after(pos, other);
+        }
+        /**
+         * @brief 单个节点版本
+         *
+         * 移动的是it之后的那一个节点
+         *
+         * @param it 被移动节点的前一个位置
+         * @note 时间：O(1), 空间：O(1)
+         */
+        void splice_after(ConstIterator pos, LinkedList& other, ConstIterator it) noexcept(AllocAlwaysEqual::value) {
+                invalidateCursor();
+                other.invalidateCursor();
+                auto prev = const_cast<NodeBase*>(pos._curr);
+                auto before = const_cast<NodeBase*>(it._curr);
+                Node* node = before -> _next;
+                if(node == nullptr || prev == before || prev == node) {
+                        return;
+                }
+                if(!(_alloc == other._alloc)) {
+                        moveNodeAfter(prev, other, before);
+                        return;
+                }
+                before -> _next = node -> _next;
+                if(other._tail == node) {
+                        other._tail = other.tailFrom(before);
+                }
+                other._length--;
+                _length++;
+                statsRecorder().on_length(_length);
+                node -> _next = prev -> _next;
+                prev -> _next = node;
+                if(node -> _next == nullptr) {
+                        _tail = node;
+                }
+        }
+        /**
+         * @brief 范围版本
+         *
+         * 移动的是开区间(first, last)中的节点
+         * pos不能位于(first, last)中
+         *
+         * @param first 范围之前的位置
+         * @param last 范围之后的位置，可以是end()
+         * @note 时间：O(k)，k为移动的节点数(用于维护长度), 空间：O(1)
+         */
+        void splice_after(ConstIterator pos, LinkedList& other, ConstIterator first, ConstIterator last) noexcept(AllocAlwaysEqual::value) {
+                invalidateCursor();
+                other.invalidateCursor();
+                auto prev = const_cast<NodeBase*>(pos._curr);
+                auto before = const_cast<NodeBase*>(first._curr);
+                auto stop = static_cast<Node*>(const_cast<NodeBase*>(last._curr));
+                Node* firstMoved = before -> _next;
+                if(firstMoved == stop || prev == before) {
+                        return;
+                }
+                if(!(_alloc == other._alloc)) {
+                        while(before -> _next != stop) {
+                                prev = moveNodeAfter(prev, other, before);
+                        }
+                        return;
+                }
+                Node* lastMoved = firstMoved;
+                int count = 1;
+                while(lastMoved -> _next != stop) {
+                        lastMoved = lastMoved -> _next;
+                        count++;
+                }
+                before -> _next = stop;
+                if(other._tail == lastMoved) {
+                        other._tail = other.tailFrom(before);
+                }
+                other._length -= count;
+                _length += count;
+                statsRecorder().on_length(_length);
+                lastMoved -> _next = prev -> _next;
+                prev -> _next = firstMoved;
+                if(lastMoved -> _next == nullptr) {
+                        _tail = lastMoved;
                 }
-                return _head -> _data;
         }
         /** @} */
         
         /**
-         * @name 获取尾元素
-         * @brief返回尾指针的数据
+         * @name 替换全部元素
+         * @brief 用新的元素替换链表内容
          *
-         * 使用empty()检查链表是否为空
-         * 使用lastNodePtr()获取尾指针
-         * 重载const和非const版本
-         * 链表为空会抛出异常
+         * 新内容建好之后才销毁旧内容，构造抛出异常时链表不变(强异常保证)
+         * 分配器支持时一次预留全部节点
          *
-         * @sa empty() lastNodePtr()
-         * @return 尾指针数据
+         * @sa assignRange()
+         * @note 时间：O(n + 原长度), 空间：O(n)
          * @{
          */
-         
-         /**
-          * @brief 非const版
-          */
-        DataType& back() {
-                if(empty()) {
-                        throw std::logic_error("LinkedList is empty");
-                }
-                return lastNodePtr() -> _data;
+        template<typename InputIt, typename = typename std::enable_if<!std::is_integral<InputIt>::value>::type>
+        void assign(InputIt first, InputIt last) {
+                assignRange(first, last, rangeSize(first, last, CanReserve()));
         }
+        void assign(std::initializer_list<DataType> init) {
+                assignRange(init.begin(), init.end(), init.size());
+        }
+        /** @} */
+#if __cplusplus >= 202002L && defined(__cpp_lib_ranges)
         /**
-         * @brief const版
+         * @name C++20范围
+         * @brief 接受任意输入范围，包括迭代器与哨兵类型不同的范围
+         *
+         * 范围可以求大小(sized_range)或可以多次遍历(forward_range)时，先预留全部节点
+         * 构造抛出异常时链表不变(强异常保证)
+         *
+         * @param range 元素的来源
+         * @note 时间：O(n), 空间：O(1)；assign_range()为 时间：O(n + 原长度), 空间：O(n)
+         * @{
          */
-        const DataType& back() const {
-                if(empty()) {
-                        throw std::logic_error("LinkedList is empty");
+private:
+        template<std::ranges::input_range Range>
+        static std::size_t rangeSize(Range& range) {
+                if constexpr(!CanReserve::value) {
+                        return 0;
+                } else if constexpr(std::ranges::sized_range<Range>) {
+                        return static_cast<std::size_t>(std::ranges::size(range));
+                } else if constexpr(std::ranges::forward_range<Range>) {
+                        return static_cast<std::size_t>(std::ranges::distance(range));
+                } else {
+                        return 0;
                 }
-                return lastNodePtr() -> _data;
         }
+public:
+        template<std::ranges::input_range Range>
+        void append_range(Range&& range) {
+                appendRange(std::ranges::begin(range), std::ranges::end(range), rangeSize(range));
+        }
+        template<std::ranges::input_range Range>
+        void assign_range(Range&& range) {
+                assignRange(std::ranges::begin(range), std::ranges::end(range), rangeSize(range));
+        }
+#if defined(__cpp_lib_containers_ranges)
+        template<std::ranges::input_range Range>
+        LinkedList(std::from_range_t, Range&& range, const Allocator& alloc = Allocator()):
+                _beforeHead(), _tail(nullptr), _cursor(nullptr), _length(0), _alloc(alloc) {
+                append_range(std::forward<Range>(range));
+        }
+#endif
         /** @} */
-        
+#else
         /**
-         * @brief 头插入
+         * @name 范围
+         * @brief 接受任何能用std::begin() std::end()遍历的对象，如容器和数组
          *
-         * 将新元素作为头元素
+         * 前向迭代器且分配器支持时先预留全部节点
+         * 构造抛出异常时链表不变(强异常保证)
          *
-         * @param data 要插入的数据
-         * @note 时间：O(1), 空间：O(1)
+         * @param range 元素的来源
+         * @note 时间：O(n), 空间：O(1)；assign_range()为 时间：O(n + 原长度), 空间：O(n)
+         * @{
          */
-        void push_front(DataType data) {
-                Node* newNode = new Node(data);
-                newNode -> _next = _head;
-                _head = newNode;
-                _length++;
+        template<typename Range>
+        void append_range(const Range& range) {
+                appendRange(std::begin(range), std::end(range), rangeSize(std::begin(range), std::end(range), CanReserve()));
         }
+        template<typename Range>
+        void assign_range(const Range& range) {
+                assignRange(std::begin(range), std::end(range), rangeSize(std::begin(range), std::end(range), CanReserve()));
+        }
+        /** @} */
+#endif
         /**
-         * @brief 尾插入
+         * @brief 尾部拼接整个链表
          *
-         * 将新元素作为尾元素
-         * 使用lastNodePtr()获取尾指针
+         * 借助_tail直接把other接在尾部
+         * other随后为空
          *
-         * @sa lastNodePtr()
-         * @param data 要插入的数据
-         * @note 时间：O(n), 空间：O(1)
+         * @sa splice_after()
+         * @param other 被拼接的链表，分配器与此链表不相等时逐个移动元素
+         * @note 时间：O(1)；分配器不相等时 O(m), 空间：O(1)
          */
-        void push_back(DataType data) {
-                Node* newNode = new Node(data);
-                Node* last = lastNodePtr();
-                last == nullptr? _head = newNode: last -> _next = newNode;
-                _length++;
+        void append(LinkedList&& other) noexcept(AllocAlwaysEqual::value) {
+                splice_after(empty()? cbefore_begin(): ConstIterator(_tail), other);
         }
+        
         /**
-         * @brief 指定位置插入
+         * @name 有序合并
+         * @brief 把有序的other合并进有序的此链表
          *
-         * 在列表中插入新元素
-         * 插入在指定位置的后方
-         * 当索引超出范围时抛出异常
-         * 当插入位置在首尾时
-         * 分别调用push_front() push_back()
+         * 只修改指针，不分配内存，也不拷贝或移动元素
+         * 稳定：相等的元素中，此链表原有的排在前面
+         * 两个链表的分配器不相等时，逐个把other的元素移动到此链表的新节点中
+         * comp抛出异常时，已合并的节点留在此链表中，其余留在other中
          *
-         * @sa push_front() push_back()
-         * @param index 要插入的位置
-         * @param data 要插入的数据
-         * @note 时间：O(n), 空间：O(1)
+         * @param other 被合并的链表，随后为空
+         * @param comp 严格弱序比较，comp(a, b)为真表示a应排在b前
+         * @note 时间：O(n + m), 空间：O(1)
+         * @{
          */
-        void insert(int index, DataType data) {
-                if(index < 0 || index > _length) {
-                        throw std::out_of_range("index out of range");
-                } else if(index == 0) {
-                        push_front(data);
+        template<typename Compare>
+        void merge(LinkedList& other, Compare comp) {
+                if(this == &other) {
                         return;
-                } else if (index == _length) {
-                        push_back(data);
+                }
+                invalidateCursor();
+                other.invalidateCursor();
+                if(!(_alloc == other._alloc)) {
+                        mergeByMove(other, comp);
                         return;
                 }
-                Node* newNode = new Node(data);
-                auto curr = _head;
-                for(int i = 0; i < index - 1; i++) {
-                        curr = curr -> _next;
+                NodeBase* prev = &_beforeHead;
+                Node* rest = other._beforeHead._next;
+                int moved = 0;
+                try {
+                        while(prev -> _next != nullptr && rest != nullptr) {
+                                if(comp(rest -> _data, prev -> _next -> _data)) {
+                                        Node* next = rest -> _next;
+                                        rest -> _next = prev -> _next;
+                                        prev -> _next = rest;
+                                        rest = next;
+                                        moved++;
+                                }
+                                prev = prev -> _next;
+                        }
+                } catch(...) {
+                        other._beforeHead._next = rest;
+                        other._length -= moved;
+                        if(rest == nullptr) {
+                                other._tail = nullptr;
+                        }
+                        _length += moved;
+                        statsRecorder().on_length(_length);
+                        throw;
                 }
-                newNode -> _next = curr -> _next;
-                curr -> _next = newNode;
-                _length++;
+                if(rest != nullptr) {
+                        prev -> _next = rest;
+                        _tail = other._tail;
+                }
+                _length += other._length;
+                statsRecorder().on_length(_length);
+                other._beforeHead._next = nullptr;
+                other._tail = nullptr;
+                other._length = 0;
+        }
+        template<typename Compare>
+        void merge(LinkedList&& other, Compare comp) {
+                merge(other, comp);
         }
         /**
-         * @brief 头删除
+         * @brief 使用operator<比较的版本
+         */
+        void merge(LinkedList& other) {
+                merge(other, [](const DataType& a, const DataType& b) { return a < b; });
+        }
+        void merge(LinkedList&& other) {
+                merge(other);
+        }
+        /** @} */
+        
+        /**
+         * @name 排序
+         * @brief 原地稳定排序
          *
-         * 删除头元素
-         * 使用checkEmptyOrSingle()进行相关检查
+         * 自底向上的归并排序
+         * 只修改Node::_next，不分配内存，也不拷贝或移动元素
+         * comp抛出异常时，所有元素仍在链表中，但顺序未指定
          *
-         * @sa checkEmptyOrSingle()
-         * @note 时间：O(1), 空间：O(1)
+         * @sa sortChain() mergeRuns()
+         * @param comp 严格弱序比较，comp(a, b)为真表示a应排在b前
+         * @note 时间：O(n log n), 空间：O(1)(固定大小的binHeads/binTails)
+         * @{
          */
-        void pop_front() {
-                if(checkEmptyOrSingle()) {
+        template<typename Compare>
+        void sort(Compare comp) {
+                if(_length < 2) {
                         return;
                 }
-                auto target = _head;
-                _head = target -> _next;
-                delete target;
-                _length--;
+                invalidateCursor();
+                Node* head = _beforeHead._next;
+                Node* tail = _tail;
+                try {
+                        sortChain(head, tail, comp);
+                } catch(...) {
+                        _beforeHead._next = head;
+                        _tail = tail;
+                        throw;
+                }
+                _beforeHead._next = head;
+                _tail = tail;
         }
         /**
-         * @brief 尾删除
+         * @brief 使用operator<比较的版本
+         */
+        void sort() {
+                sort([](const DataType& a, const DataType& b) { return a < b; });
+        }
+        /** @} */
+        /**
+         * @name 并行排序
+         * @brief 在线程池上原地稳定排序
          *
-         * 删除尾元素
-         * 使用checkEmptyOrSingle()进行相关检查
+         * 先把节点链切成与线程数相同的段(最多MaxSortPieces段，每段至少MinSortPiece个元素)
+         * 各段在线程池中同时用sortChain()排序，再两两合并，每一轮的各次合并也同时进行
+         * 与sort()一样只修改Node::_next，不分配内存，也不拷贝或移动元素
+         * 最后一轮只有一次合并，所以加速比受 O(n) 的串行合并限制
+         * comp会被多个线程同时调用，需要是线程安全的
+         * comp抛出异常时，所有元素仍在链表中，但顺序未指定
+         * 元素太少或线程池只有一个线程时退化为sort()
          *
-         * @sa checkEmptyOrSingle()
-         * @note 时间：O(n), 空间：O(1)
+         * @param pool 线程池，需提供 size() 和 submit()，默认为 ThreadPool::shared()
+         * @param comp 严格弱序比较，默认使用 operator<
+         * @note 时间：O(n log n / 线程数 + n), 空间：O(线程数)
+         * @{
          */
-        void pop_back() {
-                if(checkEmptyOrSingle()) {
+        template<typename Pool, typename Compare>
+        void parallel_sort(Pool& pool, Compare comp) {
+                int pieces = static_cast<int>(pool.size());
+                if(pieces > MaxSortPieces) {
+                        pieces = MaxSortPieces;
+                }
+                if(pieces > _length / MinSortPiece) {
+                        pieces = _length / MinSortPiece;
+                }
+                if(pieces < 2) {
+                        sort(comp);
                         return;
                 }
-                auto curr = _head;
-                while(curr -> _next -> _next != nullptr) {
+                invalidateCursor();
+                Node* heads[MaxSortPieces];
+                Node* tails[MaxSortPieces];
+                Node* curr = _beforeHead._next;
+                for(int i = 0, begin = 0; i < pieces; i++) {
+                        const int end = static_cast<int>(static_cast<long long>(_length) * (i + 1) / pieces);
+                        heads[i] = curr;
+                        for(int k = begin + 1; k < end; k++) {
+                                curr = curr -> _next;
+                        }
+                        tails[i] = curr;
                         curr = curr -> _next;
+                        tails[i] -> _next = nullptr;
+                        begin = end;
                 }
-                delete curr -> _next;
-                curr -> _next = nullptr;
-                _length--;
+                try {
+                        auto sortPiece = [&heads, &tails, &comp](int i) {
+                                sortChain(heads[i], tails[i], comp);
+                        };
+                        runParallel(pool, pieces, sortPiece);
+                        for(int step = 1; step < pieces; step *= 2) {
+                                auto mergePair = [&heads, &tails, &comp, step](int k) {
+                                        const int i = k * 2 * step;
+                                        const int j = i + step;
+                                        try {
+                                                mergeRuns(heads[i], tails[i], heads[j], tails[j], comp);
+                                        } catch(...) {
+                                                heads[j] = nullptr;
+                                                throw;
+                                        }
+                                        heads[j] = nullptr;
+                                };
+                                runParallel(pool, (pieces - step - 1) / (2 * step) + 1, mergePair);
+                        }
+                } catch(...) {
+                        NodeBase* last = &_beforeHead;
+                        for(int i = 0; i < pieces; i++) {
+                                if(heads[i] != nullptr) {
+                                        last -> _next = heads[i];
+                                        last = tails[i];
+                                }
+                        }
+                        last -> _next = nullptr;
+                        _tail = static_cast<Node*>(last);
+                        throw;
+                }
+                _beforeHead._next = heads[0];
+                _tail = tails[0];
+        }
+        template<typename Compare, typename Pool = ThreadPool>
+        void parallel_sort(Compare comp) {
+                parallel_sort(Pool::shared(), comp);
+        }
+        template<typename Pool = ThreadPool>
+        void parallel_sort() {
+                parallel_sort(Pool::shared(), [](const DataType& a, const DataType& b) { return a < b; });
         }
+        /** @} */
         /**
-         * @brief 删除指定元素
+         * @brief 按链表顺序重新分配所有节点
          *
-         * 索引如果为首元素，则调用pop_front()进行删除
-         * 索引超出范围时抛出异常
-         * 链表为空时抛出异常
+         * 频繁增删后相邻元素的节点散落在内存各处，遍历时几乎每步都缓存未命中
+         * 这里按链表顺序逐个创建新节点，把元素移动过去，再释放旧节点
+         * 分配器提供reserve()时(如PoolAllocator)先一次预留n个节点，新节点在同一大块中连续排列
+         * 否则依次分配，通常相邻但不保证
          *
-         * @param index 要删除的元素的索引
-         * @note 时间：O(n), 空间：O(1)
+         * 所有迭代器、引用都会失效，元素本身被移动而不是拷贝，只能移动的类型也可以
+         * 元素的移动构造不抛出异常(或不可拷贝)时使用移动，否则使用拷贝
+         * 先分配好全部新节点的内存，再逐个构造，分配失败时还没有移动任何元素
+         * 抛出异常时释放已创建的新节点和未使用的内存，链表保持原样(强异常保证)
+         * 整理期间新旧节点同时存在，峰值内存约为两倍
+         *
+         * @note 时间：O(n), 空间：O(n)
          */
-        void erase(int index) {
-                if(index < 0 || index >= _length) {
-                        throw std::out_of_range("index out of range");
-                } else if(empty()) {
-                        throw std::logic_error("cannot erase from empty list");
-                } else if(index == 0) {
-                        pop_front();
+        void compact() {
+                if(empty()) {
                         return;
                 }
-                auto previous = _head;
-                auto target = _head;
-                for(int i = 0; i < index; i++) {
-                        previous = target;
-                        target = target -> _next;
+                struct SpareNode { ///< 已分配、尚未构造的新节点，复用节点本身的内存做链表
+                        SpareNode* _next; ///< 下一个未构造的节点
+                };
+                SpareNode spareHead = {nullptr};
+                SpareNode* spareTail = &spareHead;
+                auto releaseSpare = [this, &spareHead]() noexcept {
+                        while(spareHead._next != nullptr) {
+                                SpareNode* spare = spareHead._next;
+                                spareHead._next = spare -> _next;
+                                NodeAllocTraits::deallocate(_alloc, static_cast<Node*>(static_cast<void*>(spare)), 1);
+                        }
+                };
+                reserveNodes(_alloc, static_cast<std::size_t>(_length), 0);
+                try {
+                        for(int i = 0; i < _length; i++) {
+                                Node* raw = NodeAllocTraits::allocate(_alloc, 1);
+                                spareTail -> _next = ::new(static_cast<void*>(raw)) SpareNode{nullptr};
+                                spareTail = spareTail -> _next;
+                        }
+                } catch(...) {
+                        releaseSpare();
+                        unreserveNodes(_alloc, 0);
+                        throw;
+                }
+                unreserveNodes(_alloc, 0);
+                NodeBase newHead;
+                NodeBase* last = &newHead;
+                try {
+                        for(Node* curr = _beforeHead._next; curr != nullptr; curr = curr -> _next) {
+                                Node* node = static_cast<Node*>(static_cast<void*>(spareHead._next));
+                                spareHead._next = spareHead._next -> _next;
+                                try {
+                                        NodeAllocTraits::construct(_alloc, node, EmplaceTag(), std::move_if_noexcept(curr -> _data));
+                                } catch(...) {
+                                        NodeAllocTraits::deallocate(_alloc, node, 1);
+                                        throw;
+                                }
+                                statsRecorder().on_allocate(1);
+                                last -> _next = node;
+                                last = node;
+                        }
+                } catch(...) {
+                        last -> _next = nullptr;
+                        walk<0>(newHead._next, [this](Node* node) -> bool {
+                                destroyNode(node);
+                                return true;
+                        });
+                        releaseSpare();
+                        throw;
                 }
-                previous -> _next = target -> _next;
-                delete target;
-                _length--;
+                walk<LINKEDLIST_PREFETCH_DISTANCE>(_beforeHead._next, [this](Node* node) -> bool {
+                        destroyNode(node);
+                        return true;
+                });
+                _beforeHead._next = newHead._next;
+                _tail = static_cast<Node*>(last);
+                invalidateCursor();
         }
 }; ///< class LinkedList
\ No newline at end of file
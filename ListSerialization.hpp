@@ -0,0 +1,375 @@
+#pragma once
+/**
+ * @file ListSerialization.hpp
+ * @brief 链表内容的二进制读写与内存映射加载
+ *
+ * 只支持平凡可拷贝的元素类型
+ * 文件格式为一个16字节的头部(ListFileHeader)后跟按链表顺序连续存放的全部元素
+ * 使用本机字节序，头部的魔数和元素大小用于发现不匹配的文件
+ *
+ * - serialize() / write_to() 按链表顺序写出，经过一个缓冲区批量写入
+ * - load_from(std::istream&) 从流中读回
+ * - MappedList 把文件映射到内存，直接在映射上按下标访问元素，不拷贝
+ * - load_from(path) 通过 MappedList 一次遍历映射重建链表
+ *   链表的范围构造函数会先预留好全部节点(PoolAllocator、SlabLinkedList 只分配一次)
+ *
+ * 适用于 LinkedList、SlabLinkedList 等有 begin()/end()/size() 和迭代器范围构造函数的容器
+ * write_to()、MappedList 和 load_from(path) 使用POSIX接口，只在类Unix系统上提供
+ *
+ * @code
+ * LinkedList<int> l = ...;
+ * std::ofstream out("list.bin", std::ios::binary);
+ * serialize(l, out);
+ * out.close();
+ * auto loaded = load_from<LinkedList<int>>("list.bin");
+ * MappedList<int> view("list.bin"); // 不构造链表，直接读
+ * @endcode
+ *
+ * @author neOzkyol
+ * @date 2026-01-20
+ * @version 1.0
+ */
+#include <climits> ///< INT_MAX
+#include <cstddef> ///< std::size_t
+#include <cstdint> ///< std::uint32_t std::uint64_t
+#include <cstring> ///< std::memcpy
+#include <istream> ///< std::istream
+#include <iterator> ///< std::iterator_traits
+#include <memory> ///< std::unique_ptr
+#include <ostream> ///< std::ostream
+#include <stdexcept> ///< std::runtime_error std::length_error
+#include <type_traits> ///< std::is_trivially_copyable std::decay std::aligned_storage
+#include <utility> ///< std::declval
+#if defined(__unix__) || defined(__APPLE__)
+#define LIST_SERIALIZATION_POSIX 1
+#include <cerrno> ///< errno EINTR
+#include <system_error> ///< std::system_error
+#include <fcntl.h> ///< open
+#include <sys/mman.h> ///< mmap munmap madvise
+#include <sys/stat.h> ///< fstat
+#include <unistd.h> ///< write close
+#endif
+/**
+ * @struct ListFileHeader
+ * @brief 序列化文件的头部
+ *
+ */
+struct ListFileHeader {
+        std::uint32_t _magic; ///< 固定为 ListFileHeader::Magic，字节序不同时读出来不相等
+        std::uint32_t _elementSize; ///< sizeof(元素类型)
+        std::uint64_t _count; ///< 元素个数
+        static const std::uint32_t Magic = 0x424C4C53u; ///< 小端序下为"SLLB"
+};
+
+/**
+ * @class ListFile
+ * @brief 序列化的实现细节：头部的生成与检查、缓冲写出
+ *
+ */
+class ListFile {
+public:
+        static const std::size_t BufferSize = 1 << 16; ///< 写出时缓冲区的字节数
+        /**
+         * @brief 容器的元素类型
+         *
+         */
+        template<typename List>
+        using ValueType = typename std::iterator_traits<decltype(std::declval<const List&>().begin())>::value_type;
+        /**
+         * @brief 生成头部
+         *
+         * @param count 元素个数
+         * @return 头部
+         */
+        template<typename T>
+        static ListFileHeader header(std::uint64_t count) noexcept {
+                ListFileHeader result;
+                result._magic = ListFileHeader::Magic;
+                result._elementSize = static_cast<std::uint32_t>(sizeof(T));
+                result._count = count;
+                return result;
+        }
+        /**
+         * @brief 检查头部
+         *
+         * 魔数或元素大小不符、元素个数超出链表长度的上限、数据不足时抛出异常
+         *
+         * @param header 读到的头部
+         * @param available 头部之后可用的字节数，未知时为 UINT64_MAX
+         * @return 元素个数
+         */
+        template<typename T>
+        static int check(const ListFileHeader& header, std::uint64_t available) {
+                if(header._magic != ListFileHeader::Magic) {
+                        throw std::runtime_error("not a serialized list, or written with a different byte order");
+                }
+                if(header._elementSize != sizeof(T)) {
+                        throw std::runtime_error("serialized list has a different element size");
+                }
+                if(header._count > static_cast<std::uint64_t>(INT_MAX)) {
+                        throw std::length_error("serialized list is too long");
+                }
+                if(header._count * sizeof(T) > available) {
+                        throw std::runtime_error("serialized list is truncated");
+                }
+                return static_cast<int>(header._count);
+        }
+        /**
+         * @brief 按链表顺序把头部和元素写给sink
+         *
+         * 链表节点不连续，先把元素拷贝进缓冲区，满了再一次交给sink
+         *
+         * @param list 容器
+         * @param sink 接受 (const char* 数据, std::size_t 字节数) 的函数
+         * @note 时间：O(n), 空间：O(BufferSize)
+         */
+        template<typename List, typename Sink>
+        static void write(const List& list, Sink& sink) {
+                using T = ValueType<List>;
+                static_assert(std::is_trivially_copyable<T>::value, "only trivially copyable elements can be serialized");
+                static_assert(sizeof(T) <= BufferSize, "element is larger than the write buffer");
+                const ListFileHeader head = header<T>(static_cast<std::uint64_t>(list.size()));
+                sink(reinterpret_cast<const char*>(&head), sizeof(head));
+                std::unique_ptr<char[]> buffer(new char[BufferSize]);
+                std::size_t used = 0;
+                for(const auto& data : list) {
+                        if(used + sizeof(T) > BufferSize) {
+                                sink(buffer.get(), used);
+                                used = 0;
+                        }
+                        std::memcpy(buffer.get() + used, &data, sizeof(T));
+                        used += sizeof(T);
+                }
+                if(used != 0) {
+                        sink(buffer.get(), used);
+                }
+        }
+}; ///< class ListFile
+
+/**
+ * @brief 把链表写入输出流
+ *
+ * 流需以二进制模式打开，写入失败时抛出 std::runtime_error
+ *
+ * @param list 容器，元素需平凡可拷贝
+ * @param out 输出流
+ * @note 时间：O(n), 空间：O(ListFile::BufferSize)
+ */
+template<typename List>
+void serialize(const List& list, std::ostream& out) {
+        auto sink = [&out](const char* data, std::size_t bytes) {
+                if(!out.write(data, static_cast<std::streamsize>(bytes))) {
+                        throw std::runtime_error("failed to write serialized list");
+                }
+        };
+        ListFile::write(list, sink);
+}
+
+/**
+ * @brief 从输入流读回链表
+ *
+ * 格式不符或数据不足时抛出异常
+ * 每次读入一批元素，再逐个push_back()
+ *
+ * @tparam List 容器类型，元素需平凡可拷贝
+ * @param in 以二进制模式打开的输入流
+ * @return 读到的链表
+ * @note 时间：O(n), 空间：O(ListFile::BufferSize)
+ */
+template<typename List>
+List load_from(std::istream& in) {
+        using T = ListFile::ValueType<List>;
+        static_assert(std::is_trivially_copyable<T>::value, "only trivially copyable elements can be serialized");
+        ListFileHeader head;
+        if(!in.read(reinterpret_cast<char*>(&head), sizeof(head))) {
+                throw std::runtime_error("serialized list is truncated");
+        }
+        int remaining = ListFile::check<T>(head, UINT64_MAX);
+        const int batch = static_cast<int>(ListFile::BufferSize / sizeof(T)) + 1;
+        std::unique_ptr<typename std::aligned_storage<sizeof(T), alignof(T)>::type[]> buffer(
+                new typename std::aligned_storage<sizeof(T), alignof(T)>::type[batch]);
+        const T* elements = reinterpret_cast<const T*>(buffer.get());
+        List result;
+        while(remaining > 0) {
+                const int count = remaining < batch? remaining: batch;
+                if(!in.read(reinterpret_cast<char*>(buffer.get()), static_cast<std::streamsize>(count * sizeof(T)))) {
+                        throw std::runtime_error("serialized list is truncated");
+                }
+                for(int i = 0; i < count; i++) {
+                        result.push_back(elements[i]);
+                }
+                remaining -= count;
+        }
+        return result;
+}
+
+#ifdef LIST_SERIALIZATION_POSIX
+/**
+ * @brief 把链表写入文件描述符
+ *
+ * 处理部分写入和EINTR，失败时抛出 std::system_error
+ * 不关闭fd，也不调用fsync
+ *
+ * @param list 容器，元素需平凡可拷贝
+ * @param fd 以写方式打开的文件描述符
+ * @note 时间：O(n), 空间：O(ListFile::BufferSize)
+ */
+template<typename List>
+void write_to(const List& list, int fd) {
+        auto sink = [fd](const char* data, std::size_t bytes) {
+                while(bytes > 0) {
+                        const ssize_t written = ::write(fd, data, bytes);
+                        if(written < 0) {
+                                if(errno == EINTR) {
+                                        continue;
+                                }
+                                throw std::system_error(errno, std::generic_category(), "failed to write serialized list");
+                        }
+                        data += written;
+                        bytes -= static_cast<std::size_t>(written);
+                }
+        };
+        ListFile::write(list, sink);
+}
+
+/**
+ * @class MappedList
+ * @brief 内存映射的序列化文件，直接在映射上只读访问元素
+ *
+ * 构造时映射整个文件并检查头部，元素就在映射中连续存放，不拷贝、不分配
+ * 页面在第一次访问时才从磁盘读入
+ * 可以移动，不可拷贝，析构时解除映射
+ *
+ * @tparam T 元素类型，需平凡可拷贝，且对齐不超过头部大小(16字节)
+ */
+template<typename T>
+class MappedList {
+private:
+        static_assert(std::is_trivially_copyable<T>::value, "only trivially copyable elements can be mapped");
+        static_assert(alignof(T) <= sizeof(ListFileHeader), "element alignment exceeds the header size");
+        void* _mapping; ///< 映射的起始地址，没有映射时为 nullptr
+        std::size_t _bytes; ///< 映射的字节数
+        const T* _data; ///< 第一个元素
+        int _length; ///< 元素个数
+        /**
+         * @brief 解除映射
+         *
+         */
+        void unmap() noexcept {
+                if(_mapping != nullptr) {
+                        ::munmap(_mapping, _bytes);
+                }
+                _mapping = nullptr;
+                _bytes = 0;
+                _data = nullptr;
+                _length = 0;
+        }
+public:
+        /**
+         * @brief 构造函数
+         *
+         * 打开、映射并检查文件，系统调用失败时抛出 std::system_error，格式不符时抛出 std::runtime_error
+         *
+         * @param path 文件路径
+         */
+        explicit MappedList(const char* path): _mapping(nullptr), _bytes(0), _data(nullptr), _length(0) {
+                int fd;
+                do {
+                        fd = ::open(path, O_RDONLY);
+                } while(fd < 0 && errno == EINTR);
+                if(fd < 0) {
+                        throw std::system_error(errno, std::generic_category(), "failed to open serialized list");
+                }
+                struct stat info;
+                if(::fstat(fd, &info) != 0) {
+                        const int error = errno;
+                        ::close(fd);
+                        throw std::system_error(error, std::generic_category(), "failed to stat serialized list");
+                }
+                if(static_cast<std::uint64_t>(info.st_size) < sizeof(ListFileHeader)) {
+                        ::close(fd);
+                        throw std::runtime_error("serialized list is truncated");
+                }
+                _bytes = static_cast<std::size_t>(info.st_size);
+                void* mapping = ::mmap(nullptr, _bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+                const int error = errno;
+                ::close(fd);
+                if(mapping == MAP_FAILED) {
+                        _bytes = 0;
+                        throw std::system_error(error, std::generic_category(), "failed to map serialized list");
+                }
+                _mapping = mapping;
+                ::madvise(_mapping, _bytes, MADV_SEQUENTIAL);
+                try {
+                        _length = ListFile::check<T>(*static_cast<const ListFileHeader*>(_mapping), _bytes - sizeof(ListFileHeader));
+                } catch(...) {
+                        unmap();
+                        throw;
+                }
+                _data = reinterpret_cast<const T*>(static_cast<const char*>(_mapping) + sizeof(ListFileHeader));
+        }
+        MappedList(const MappedList&) = delete;
+        MappedList& operator=(const MappedList&) = delete;
+        MappedList(MappedList&& other) noexcept:
+                _mapping(other._mapping), _bytes(other._bytes), _data(other._data), _length(other._length) {
+                other._mapping = nullptr;
+                other.unmap();
+        }
+        MappedList& operator=(MappedList&& other) noexcept {
+                if(this != &other) {
+                        unmap();
+                        _mapping = other._mapping;
+                        _bytes = other._bytes;
+                        _data = other._data;
+                        _length = other._length;
+                        other._mapping = nullptr;
+                        other.unmap();
+                }
+                return *this;
+        }
+        ~MappedList() {
+                unmap();
+        }
+        /**
+         * @name 访问元素
+         * @brief 元素在映射中连续存放，迭代器就是指针
+         * @{
+         */
+        const T* begin() const noexcept {
+                return _data;
+        }
+        const T* end() const noexcept {
+                return _data + _length;
+        }
+        const T* data() const noexcept {
+                return _data;
+        }
+        const T& operator[](int index) const noexcept {
+                return _data[index];
+        }
+        int size() const noexcept {
+                return _length;
+        }
+        bool empty() const noexcept {
+                return _length == 0;
+        }
+        /** @} */
+}; ///< class MappedList
+
+/**
+ * @brief 通过内存映射从文件加载链表
+ *
+ * 用映射中的元素范围构造链表，只遍历一次映射
+ * 指针是随机访问迭代器，链表能先预留好全部节点
+ *
+ * @tparam List 容器类型，元素需平凡可拷贝
+ * @param path 文件路径
+ * @return 加载的链表
+ * @note 时间：O(n), 空间：O(n)
+ */
+template<typename List>
+List load_from(const char* path) {
+        MappedList<ListFile::ValueType<List>> mapped(path);
+        return List(mapped.begin(), mapped.end());
+}
+#endif
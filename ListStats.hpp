@@ -0,0 +1,251 @@
+#pragma once
+/**
+ * @file ListStats.hpp
+ * @brief LinkedList的统计策略
+ *
+ * LinkedList的第三个模板参数，决定是否统计链表的使用情况
+ * - NoListStats(默认)：所有记录函数都是空的内联函数，编译后不留任何代码，也不占用链表对象的空间
+ * - ListStats：按链表实例统计各类操作次数、按索引定位时走过的节点数、节点分配和释放次数、峰值长度
+ *
+ * 用法：
+ * @code
+ * LinkedList<int, std::allocator<int>, ListStats> l;
+ * ...
+ * l.stats().dump(std::cerr);
+ * ListStats total;
+ * total += a.stats();
+ * total += b.stats(); // 汇总多个链表
+ * @endcode
+ *
+ * @note ListStats不是线程安全的，启用统计后多个线程同时调用同一链表的const函数(如operator[])也需要外部同步
+ *
+ * @author neOzkyol
+ * @date 2026-01-21
+ * @version 1.0
+ */
+#include <cstddef> ///< std::size_t
+#include <cstdint> ///< std::uint64_t
+#include <ostream> ///< std::ostream
+#include <type_traits> ///< std::is_empty
+/**
+ * @brief 统计的操作种类
+ *
+ */
+enum class ListOperation {
+        PushFront, ///< push_front() emplace_front()
+        PushBack, ///< push_back() emplace_back()
+        PopFront, ///< pop_front()
+        PopBack, ///< pop_back()，单向链表需要走到尾部
+        Insert, ///< insert(index)
+        Erase, ///< erase(index)
+        Access, ///< operator[]
+        Find, ///< find() find_index() count() contains()，都是完整的线性查找
+        Count ///< 种类数，不是一种操作
+};
+
+/**
+ * @struct NoListStats
+ * @brief 不统计
+ *
+ * LinkedList的默认统计策略，也是统计策略需要提供的接口
+ *
+ */
+struct NoListStats {
+        void on_operation(ListOperation) noexcept {}
+        void on_walk(std::size_t) noexcept {}
+        void on_allocate(std::size_t) noexcept {}
+        void on_deallocate(std::size_t) noexcept {}
+        void on_length(int) noexcept {}
+        void on_snapshot(int, std::size_t) noexcept {}
+        void absorb(const NoListStats&) noexcept {}
+};
+
+/**
+ * @struct ListStats
+ * @brief 统计一个链表实例的使用情况
+ *
+ * 链表通过 on_* 函数记录事件，LinkedList::stats() 返回带有当前长度的副本
+ * 分配和释放次数记在执行分配和释放的链表上，
+ * 节点通过移动、splice_after()、merge() 转到别的链表后，由接收方释放
+ *
+ */
+struct ListStats {
+        std::uint64_t _operations[static_cast<int>(ListOperation::Count)]; ///< 各类操作的次数
+        std::uint64_t _walks; ///< 按索引定位(operator[] insert erase pop_back)走过的次数
+        std::uint64_t _walkedNodes; ///< 按索引定位时走过的节点总数
+        std::uint64_t _longestWalk; ///< 一次定位最多走过的节点数
+        std::uint64_t _allocations; ///< 分配的节点数
+        std::uint64_t _deallocations; ///< 释放的节点数
+        std::uint64_t _length; ///< 取快照时的长度，汇总时为各链表之和
+        std::uint64_t _peakLength; ///< 长度的峰值，汇总时为各链表峰值之和
+        std::size_t _nodeBytes; ///< 每个节点的字节数，取快照时填入
+        ListStats() noexcept:
+                _operations(), _walks(0), _walkedNodes(0), _longestWalk(0), _allocations(0), _deallocations(0),
+                _length(0), _peakLength(0), _nodeBytes(0) {}
+        /**
+         * @name 链表调用的记录函数
+         * @{
+         */
+        void on_operation(ListOperation operation) noexcept {
+                _operations[static_cast<int>(operation)]++;
+        }
+        void on_walk(std::size_t nodes) noexcept {
+                _walks++;
+                _walkedNodes += nodes;
+                if(nodes > _longestWalk) {
+                        _longestWalk = nodes;
+                }
+        }
+        void on_allocate(std::size_t nodes) noexcept {
+                _allocations += nodes;
+        }
+        void on_deallocate(std::size_t nodes) noexcept {
+                _deallocations += nodes;
+        }
+        /**
+         * @brief 长度增加之后调用，更新峰值
+         *
+         * @param length 新的长度
+         */
+        void on_length(int length) noexcept {
+                if(static_cast<std::uint64_t>(length) > _peakLength) {
+                        _peakLength = static_cast<std::uint64_t>(length);
+                }
+        }
+        /**
+         * @brief 填入取快照时的长度和节点大小
+         *
+         * @param length 当前长度
+         * @param nodeBytes sizeof(Node)
+         */
+        void on_snapshot(int length, std::size_t nodeBytes) noexcept {
+                _length = static_cast<std::uint64_t>(length);
+                _nodeBytes = nodeBytes;
+        }
+        /**
+         * @brief 并入链表内部临时链表的事件
+         *
+         * 只累加次数，不改变长度和峰值
+         * 拷贝赋值、assign() 先在临时链表中建好内容，它的分配次数通过这里记到此链表上
+         *
+         * @param other 临时链表的统计
+         */
+        void absorb(const ListStats& other) noexcept {
+                for(int i = 0; i < static_cast<int>(ListOperation::Count); i++) {
+                        _operations[i] += other._operations[i];
+                }
+                _walks += other._walks;
+                _walkedNodes += other._walkedNodes;
+                if(other._longestWalk > _longestWalk) {
+                        _longestWalk = other._longestWalk;
+                }
+                _allocations += other._allocations;
+                _deallocations += other._deallocations;
+        }
+        /** @} */
+
+        /**
+         * @brief 汇总另一个链表的统计
+         *
+         * 次数累加，长度和峰值也累加(峰值之和是同时存在时的上界)
+         *
+         * @param other 另一个链表的 stats()
+         * @return 自己
+         */
+        ListStats& operator+=(const ListStats& other) noexcept {
+                absorb(other);
+                _length += other._length;
+                _peakLength += other._peakLength;
+                if(_nodeBytes == 0) {
+                        _nodeBytes = other._nodeBytes;
+                }
+                return *this;
+        }
+        /**
+         * @brief 获取某类操作的次数
+         *
+         * @param operation 操作种类
+         * @return 次数
+         */
+        std::uint64_t operations(ListOperation operation) const noexcept {
+                return _operations[static_cast<int>(operation)];
+        }
+        /**
+         * @brief 平均每次定位走过的节点数
+         *
+         * @return 平均值，没有定位过时为0
+         */
+        double average_walk() const noexcept {
+                return _walks == 0? 0.0: static_cast<double>(_walkedNodes) / static_cast<double>(_walks);
+        }
+        /**
+         * @brief 节点当前占用的字节数
+         *
+         * 只计节点本身，不含分配器的额外开销和元素自己申请的内存
+         *
+         * @return 长度 × 节点大小
+         */
+        std::uint64_t live_bytes() const noexcept {
+                return _length * _nodeBytes;
+        }
+        /**
+         * @brief 节点占用字节数的峰值
+         *
+         * @return 峰值长度 × 节点大小
+         */
+        std::uint64_t peak_bytes() const noexcept {
+                return _peakLength * _nodeBytes;
+        }
+        /**
+         * @brief 输出为一行可读的文本
+         *
+         * @param out 输出流
+         * @return out
+         */
+        std::ostream& dump(std::ostream& out) const {
+                static const char* const names[] = {
+                        "push_front", "push_back", "pop_front", "pop_back", "insert", "erase", "access", "find"
+                };
+                for(int i = 0; i < static_cast<int>(ListOperation::Count); i++) {
+                        out << names[i] << '=' << _operations[i] << ' ';
+                }
+                out << "walks=" << _walks << " walked_nodes=" << _walkedNodes
+                        << " average_walk=" << average_walk() << " longest_walk=" << _longestWalk
+                        << " allocations=" << _allocations << " deallocations=" << _deallocations
+                        << " length=" << _length << " peak_length=" << _peakLength
+                        << " live_bytes=" << live_bytes() << " peak_bytes=" << peak_bytes() << '\n';
+                return out;
+        }
+};
+
+/**
+ * @class ListStatsStorage
+ * @brief 保存统计策略的基类
+ *
+ * LinkedList的实现细节，LinkedList私有继承它
+ * 统计策略是空类(如NoListStats)时自己也继承它，通过空基类优化不占用链表对象的空间
+ * 否则作为mutable成员保存，const函数中也能记录
+ *
+ * @tparam Stats 统计策略，空类时不能是final
+ */
+template<typename Stats, bool = std::is_empty<Stats>::value>
+class ListStatsStorage {
+private:
+        mutable Stats _stats; ///< 统计
+protected:
+        /**
+         * @brief 获取统计策略对象
+         *
+         * @return 可以记录事件的引用，const函数中也可以使用
+         */
+        Stats& statsRecorder() const noexcept {
+                return _stats;
+        }
+};
+template<typename Stats>
+class ListStatsStorage<Stats, true>: private Stats {
+protected:
+        Stats& statsRecorder() const noexcept {
+                return const_cast<ListStatsStorage&>(*this); // 空类没有可修改的状态
+        }
+};
@@ -0,0 +1,222 @@
+#pragma once
+/**
+ * @file MPSCQueue.hpp
+ * @class MPSCQueue
+ * @brief 一个基于模板的多生产者单消费者无锁队列(Vyukov算法)
+ *
+ * 生产者调用push_back() emplace_back()，可以有任意多个线程同时调用
+ * 消费者调用pop_front() pop_all() empty()，同一时刻只能有一个线程调用
+ *
+ * 队列始终以一个不含数据的哑节点开头，_head指向它，_tail指向最后一个节点(与LinkedList的_tail相同)
+ * 生产者用一次原子交换把新节点挂到_tail，再把旧的_tail节点的_next指向新节点
+ * 消费者取出哑节点的后继中的数据，然后释放哑节点，后继成为新的哑节点
+ * 哑节点的_next不为空之后才会被释放，此时唯一会写它的生产者已经写完，所以不需要延迟回收
+ *
+ * 生产者在两步之间被挂起时，后面的节点暂时无法到达，消费者会认为队列在此处结束
+ *
+ * @author neOzkyol
+ * @date 2026-01-18
+ * @version 1.0
+ */
+#include <atomic> ///< std::atomic
+#include <new> ///< placement new
+#include <thread> ///< std::this_thread::yield
+#include <type_traits> ///< std::aligned_storage std::is_nothrow_move_constructible
+#include <utility> ///< std::move std::forward std::move_if_noexcept
+#include "LinkedList.hpp"
+template<typename DataType> ///< 队列存储的数据类型
+class MPSCQueue {
+private:
+        struct Node { ///< 队列节点，哑节点中没有构造数据
+                std::atomic<Node*> _next; ///< 指向下一个节点的指针
+                typename std::aligned_storage<sizeof(DataType), alignof(DataType)>::type _storage; ///< 数据的存储空间
+                Node(): _next(nullptr){}
+                DataType& data() noexcept {
+                        return *reinterpret_cast<DataType*>(&_storage);
+                }
+        };
+        Node* _head; ///< 哑节点，只由消费者访问
+        std::atomic<Node*> _tail; ///< 最后一个节点，由生产者修改
+        /**
+         * @brief 把新节点挂到队尾
+         *
+         * @param node 新节点，数据已构造
+         */
+        void pushNode(Node* node) noexcept {
+                Node* prev = _tail.exchange(node, std::memory_order_acq_rel);
+                prev -> _next.store(node, std::memory_order_release);
+        }
+        /**
+         * @brief 分配节点并原地构造数据
+         *
+         * 构造抛出异常时释放节点
+         *
+         * @param args 构造参数
+         * @return 新节点
+         */
+        template<typename... Args>
+        static Node* createNode(Args&&... args) {
+                Node* node = new Node();
+                try {
+                        ::new(static_cast<void*>(&node -> _storage)) DataType(std::forward<Args>(args)...);
+                } catch(...) {
+                        delete node;
+                        throw;
+                }
+                return node;
+        }
+public:
+        /**
+         * @brief 无参构造函数
+         *
+         * 创建哑节点，_head和_tail都指向它
+         *
+         */
+        MPSCQueue(): _head(new Node()), _tail(_head) {}
+        MPSCQueue(const MPSCQueue&) = delete;
+        MPSCQueue& operator=(const MPSCQueue&) = delete;
+        /**
+         * @brief 析构函数
+         *
+         * 调用时不能再有其他线程访问此队列
+         *
+         * @note 时间：O(n), 空间：O(1)
+         */
+        ~MPSCQueue() {
+                Node* curr = _head -> _next.load();
+                delete _head;
+                while(curr != nullptr) {
+                        Node* next = curr -> _next.load();
+                        curr -> data().~DataType();
+                        delete curr;
+                        curr = next;
+                }
+        }
+        /**
+         * @brief 队列是否为空
+         *
+         * 只能由消费者调用
+         *
+         * @retval true 队列为空，或下一个元素还没有挂好
+         * @retval false 反之
+         */
+        bool empty() const noexcept {
+                return _head -> _next.load(std::memory_order_acquire) == nullptr;
+        }
+        /**
+         * @name 尾插入
+         * @brief 在队尾加入一个元素
+         *
+         * 分为拷贝、移动和原地构造三个版本
+         * 可以被任意多个生产者同时调用
+         *
+         * @note 时间：O(1), 空间：O(1)，无等待
+         * @{
+         */
+        void push_back(const DataType& data) {
+                pushNode(createNode(data));
+        }
+        void push_back(DataType&& data) {
+                pushNode(createNode(std::move(data)));
+        }
+        template<typename... Args>
+        void emplace_back(Args&&... args) {
+                pushNode(createNode(std::forward<Args>(args)...));
+        }
+        /** @} */
+        /**
+         * @brief 头删除
+         *
+         * 取出队首元素，只能由消费者调用
+         *
+         * @param data 返回被取出的数据
+         * @retval true 取出成功
+         * @retval false 队列为空，或下一个元素还没有挂好
+         * @note 时间：O(1), 空间：O(1)，无等待
+         */
+        bool pop_front(DataType& data) {
+                Node* next = _head -> _next.load(std::memory_order_acquire);
+                if(next == nullptr) {
+                        return false;
+                }
+                data = std::move(next -> data());
+                next -> data().~DataType();
+                delete _head;
+                _head = next;
+                return true;
+        }
+        /**
+         * @brief 批量删除
+         *
+         * 只能由消费者调用
+         * 先记下此刻的_tail，取出从队首到它为止的元素，之后加入的元素留在队列中
+         * 其间若有生产者还没挂好的节点，等待它挂好
+         * 元素按加入顺序(先进先出)放入返回的LinkedList
+         * 取出时节点仍留在队列中，全部放入链表之后才一起释放
+         *
+         * 构造链表时抛出异常(如分配节点失败)，队列保持原样：
+         * 元素的移动构造不抛出异常时，已放入链表的元素移回原节点；
+         * 否则放入链表的是副本(std::move_if_noexcept)，原节点中的元素没有变化
+         * 只能移动且移动可能抛出异常的类型例外：已移出的元素无法放回，随链表丢弃，其余元素留在队列中
+         *
+         * @return 包含所有元素的链表，队列为空时返回空链表
+         * @note 时间：O(n), 空间：O(n)
+         */
+        LinkedList<DataType> pop_all() {
+                LinkedList<DataType> result;
+                Node* last = _tail.load(std::memory_order_acquire);
+                Node* curr = _head;
+                try {
+                        while(curr != last) {
+                                Node* next;
+                                while((next = curr -> _next.load(std::memory_order_acquire)) == nullptr) {
+                                        std::this_thread::yield(); // 生产者在两步之间，通常很快就会挂好
+                                }
+                                result.push_back(std::move_if_noexcept(next -> data()));
+                                curr = next;
+                        }
+                } catch(...) {
+                        restoreBatch(curr, result);
+                        throw;
+                }
+                advanceTo(curr);
+                return result;
+        }
+private:
+        /**
+         * @brief 释放队首到node之间的节点，node成为新的哑节点
+         *
+         * 只由消费者调用，这些节点中的元素已经取出(或是副本的来源)，一并析构
+         *
+         * @param node 最后一个已取出元素的节点
+         */
+        void advanceTo(Node* node) noexcept {
+                while(_head != node) {
+                        Node* next = _head -> _next.load(std::memory_order_relaxed);
+                        next -> data().~DataType();
+                        delete _head;
+                        _head = next;
+                }
+        }
+        /**
+         * @brief pop_all()失败时保留已取出的元素
+         *
+         * @param consumed 最后一个已取出元素的节点，_head时表示一个也没有取出
+         * @param moved 已取出的元素，与(_head, consumed]中的节点一一对应
+         */
+        void restoreBatch(Node* consumed, LinkedList<DataType>& moved) noexcept {
+                if(!std::is_nothrow_move_constructible<DataType>::value && std::is_copy_constructible<DataType>::value) {
+                        return; // 取出的是副本，原节点中的元素完好
+                }
+                if(std::is_nothrow_move_constructible<DataType>::value) {
+                        Node* node = _head;
+                        for(auto& data : moved) {
+                                node = node -> _next.load(std::memory_order_relaxed);
+                                node -> data().~DataType();
+                                ::new(static_cast<void*>(&node -> _storage)) DataType(std::move(data));
+                        }
+                        return;
+                }
+                advanceTo(consumed);
+        }
+}; ///< class MPSCQueue
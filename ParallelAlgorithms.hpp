@@ -0,0 +1,273 @@
+#pragma once
+/**
+ * @file ParallelAlgorithms.hpp
+ * @brief 链表上的并行算法
+ *
+ * parallel_for_each / parallel_transform_reduce / parallel_count_if / parallel_find_if
+ * 适用于 LinkedList、UnrolledLinkedList、IndexedLinkedList 等有 begin()/end()/size() 的容器
+ *
+ * 链表不能随机访问，所以调用线程沿链表走一遍找每块的起点
+ * 每走到一块的起点就立即把这一块提交给线程池，找边界与前面各块的处理同时进行
+ * 块数约为线程数的4倍，每块至少 ParallelChunks::MinChunk 个元素，较短的链表不会被切得过碎
+ *
+ * 传入的函数会在多个线程中同时调用，需要是线程安全的
+ * 处理期间不能修改链表的结构(插入、删除、排序等)
+ *
+ * @code
+ * LinkedList<int> l = ...;
+ * long long sum = parallel_transform_reduce(l, 0LL,
+ *         [](long long a, long long b) { return a + b; },
+ *         [](int x) { return static_cast<long long>(x) * x; });
+ * @endcode
+ *
+ * @author neOzkyol
+ * @date 2026-01-18
+ * @version 1.0
+ */
+#include <atomic> ///< std::atomic
+#include <climits> ///< INT_MAX
+#include <future> ///< std::future
+#include <utility> ///< std::move std::pair
+#include <vector> ///< std::vector
+#include "ThreadPool.hpp" ///< ThreadPool
+/**
+ * @class ParallelChunks
+ * @brief 并行算法的实现细节：分块、提交、等待
+ *
+ */
+class ParallelChunks {
+public:
+        static const int MinChunk = 1024; ///< 每块至少的元素个数
+        /**
+         * @brief 计算块数
+         *
+         * @param pool 线程池
+         * @param length 元素个数
+         * @return 块数，length > 0 时至少为1
+         */
+        static int chunkCount(const ThreadPool& pool, int length) noexcept {
+                const long long byThreads = static_cast<long long>(pool.size()) * 4;
+                const long long bySize = (static_cast<long long>(length) + MinChunk - 1) / MinChunk;
+                return static_cast<int>(byThreads < bySize? byThreads: bySize);
+        }
+        /**
+         * @brief 等待所有任务结束，不取结果
+         *
+         * 返回之后任务不再引用调用者栈上的对象
+         *
+         * @param futures 任务的future
+         */
+        template<typename Result>
+        static void waitAll(std::vector<std::future<Result>>& futures) noexcept {
+                for(auto& future : futures) {
+                        if(future.valid()) {
+                                future.wait();
+                        }
+                }
+        }
+        /**
+         * @brief 分块并提交
+         *
+         * 第i块调用 task(i, 块的第一个迭代器, 块的元素个数)
+         * 提交中途抛出异常时，先等待已提交的块结束再继续抛出
+         *
+         * @param pool 线程池
+         * @param first 第一个元素的迭代器
+         * @param length 元素个数
+         * @param task 处理一块的函数，调用者保证它活到所有块结束
+         * @param stop 不为 nullptr 且 *stop < i 时不再提交第i块及之后的块
+         * @return 各块结果的future，按块的顺序排列
+         * @note 时间：调用线程O(n)，只做指针跳转
+         */
+        template<typename Iterator, typename Task>
+        static auto submit(ThreadPool& pool, Iterator first, int length, Task& task, const std::atomic<int>* stop = nullptr)
+                -> std::vector<std::future<decltype(task(0, first, 0))>> {
+                using Result = decltype(task(0, first, 0));
+                std::vector<std::future<Result>> futures;
+                if(length <= 0) {
+                        return futures;
+                }
+                const int chunks = chunkCount(pool, length);
+                futures.reserve(chunks);
+                try {
+                        int begin = 0;
+                        for(int i = 0; i < chunks; i++) {
+                                if(stop != nullptr && stop -> load(std::memory_order_relaxed) < i) {
+                                        break;
+                                }
+                                const int end = static_cast<int>(static_cast<long long>(length) * (i + 1) / chunks);
+                                const int count = end - begin;
+                                futures.push_back(pool.submit([&task, i, first, count] {
+                                        return task(i, first, count);
+                                }));
+                                if(i + 1 < chunks) {
+                                        for(int k = 0; k < count; k++) {
+                                                ++first;
+                                        }
+                                }
+                                begin = end;
+                        }
+                } catch(...) {
+                        waitAll(futures);
+                        throw;
+                }
+                return futures;
+        }
+}; ///< class ParallelChunks
+
+/**
+ * @name 并行for_each
+ * @brief 对每个元素调用f
+ *
+ * 任何一块中f抛出异常时，等待所有块结束后抛出第一块的异常
+ *
+ * @param pool 线程池，省略时使用 ThreadPool::shared()
+ * @param list 容器
+ * @param f 接受元素引用的函数，会被多个线程同时调用
+ * @note 时间：O(n / 线程数 + n 次指针跳转), 空间：O(线程数)
+ * @{
+ */
+template<typename List, typename Function>
+void parallel_for_each(ThreadPool& pool, List& list, Function f) {
+        using Iterator = decltype(list.begin());
+        auto task = [&f](int, Iterator it, int count) {
+                for(int k = 0; k < count; k++, ++it) {
+                        f(*it);
+                }
+        };
+        auto futures = ParallelChunks::submit(pool, list.begin(), static_cast<int>(list.size()), task);
+        ParallelChunks::waitAll(futures);
+        for(auto& future : futures) {
+                future.get();
+        }
+}
+template<typename List, typename Function>
+void parallel_for_each(List& list, Function f) {
+        parallel_for_each(ThreadPool::shared(), list, std::move(f));
+}
+/** @} */
+
+/**
+ * @name 并行transform_reduce
+ * @brief 计算 reduce(...reduce(init, transform(a0))..., transform(an))
+ *
+ * 每块先在块内归约，再按块的顺序与init归约
+ * reduce需要满足结合律，不要求交换律
+ *
+ * @param pool 线程池，省略时使用 ThreadPool::shared()
+ * @param list 容器
+ * @param init 初始值
+ * @param reduce 二元归约函数
+ * @param transform 一元变换函数
+ * @return 归约结果
+ * @note 时间：O(n / 线程数 + n 次指针跳转), 空间：O(线程数)
+ * @{
+ */
+template<typename List, typename T, typename Reduce, typename Transform>
+T parallel_transform_reduce(ThreadPool& pool, const List& list, T init, Reduce reduce, Transform transform) {
+        using Iterator = decltype(list.begin());
+        auto task = [&reduce, &transform](int, Iterator it, int count) -> T {
+                T partial = transform(*it);
+                for(int k = 1; k < count; k++) {
+                        ++it;
+                        partial = reduce(std::move(partial), transform(*it));
+                }
+                return partial;
+        };
+        auto futures = ParallelChunks::submit(pool, list.begin(), static_cast<int>(list.size()), task);
+        ParallelChunks::waitAll(futures);
+        for(auto& future : futures) {
+                init = reduce(std::move(init), future.get());
+        }
+        return init;
+}
+template<typename List, typename T, typename Reduce, typename Transform>
+T parallel_transform_reduce(const List& list, T init, Reduce reduce, Transform transform) {
+        return parallel_transform_reduce(ThreadPool::shared(), list, std::move(init), std::move(reduce), std::move(transform));
+}
+/** @} */
+
+/**
+ * @name 并行count_if
+ * @brief 统计满足pred的元素个数
+ *
+ * @param pool 线程池，省略时使用 ThreadPool::shared()
+ * @param list 容器
+ * @param pred 一元谓词
+ * @return 个数
+ * @note 时间：O(n / 线程数 + n 次指针跳转), 空间：O(线程数)
+ * @{
+ */
+template<typename List, typename Predicate>
+int parallel_count_if(ThreadPool& pool, const List& list, Predicate pred) {
+        using Iterator = decltype(list.begin());
+        auto task = [&pred](int, Iterator it, int count) -> int {
+                int result = 0;
+                for(int k = 0; k < count; k++, ++it) {
+                        if(pred(*it)) {
+                                result++;
+                        }
+                }
+                return result;
+        };
+        auto futures = ParallelChunks::submit(pool, list.begin(), static_cast<int>(list.size()), task);
+        ParallelChunks::waitAll(futures);
+        int result = 0;
+        for(auto& future : futures) {
+                result += future.get();
+        }
+        return result;
+}
+template<typename List, typename Predicate>
+int parallel_count_if(const List& list, Predicate pred) {
+        return parallel_count_if(ThreadPool::shared(), list, std::move(pred));
+}
+/** @} */
+
+/**
+ * @name 并行find_if
+ * @brief 寻找第一个满足pred的元素
+ *
+ * 某一块找到后记下块号，之后的块每隔64个元素检查一次，发现前面的块已找到就提前结束
+ * 调用线程也不再提交后面的块
+ * 返回的总是链表顺序中的第一个，与串行查找相同
+ *
+ * @param pool 线程池，省略时使用 ThreadPool::shared()
+ * @param list 容器
+ * @param pred 一元谓词
+ * @return 找到的迭代器，未找到时为 list.end()
+ * @note 时间：O(n / 线程数 + n 次指针跳转), 空间：O(线程数)
+ * @{
+ */
+template<typename List, typename Predicate>
+auto parallel_find_if(ThreadPool& pool, List& list, Predicate pred) -> decltype(list.begin()) {
+        using Iterator = decltype(list.begin());
+        std::atomic<int> found(INT_MAX);
+        auto task = [&pred, &found](int index, Iterator it, int count) -> std::pair<bool, Iterator> {
+                for(int k = 0; k < count; k++, ++it) {
+                        if((k & 63) == 0 && found.load(std::memory_order_relaxed) < index) {
+                                break;
+                        }
+                        if(pred(*it)) {
+                                int current = found.load(std::memory_order_relaxed);
+                                while(index < current && !found.compare_exchange_weak(current, index, std::memory_order_relaxed)) {}
+                                return std::make_pair(true, it);
+                        }
+                }
+                return std::make_pair(false, it);
+        };
+        auto futures = ParallelChunks::submit(pool, list.begin(), static_cast<int>(list.size()), task, &found);
+        ParallelChunks::waitAll(futures);
+        for(auto& future : futures) {
+                auto result = future.get();
+                if(result.first) {
+                        return result.second;
+                }
+        }
+        return list.end();
+}
+template<typename List, typename Predicate>
+auto parallel_find_if(List& list, Predicate pred) -> decltype(list.begin()) {
+        return parallel_find_if(ThreadPool::shared(), list, std::move(pred));
+}
+/** @} */
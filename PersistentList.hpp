@@ -0,0 +1,509 @@
+#pragma once
+/**
+ * @file PersistentList.hpp
+ * @class PersistentList
+ * @brief 节点不可变、共享尾部的持久化单向链表
+ *
+ * 节点一经创建就不再修改，每个节点带一个原子引用计数
+ * push_front() 创建新的首节点，直接指向原来的节点，原来的整条链与其他副本共享
+ * pop_front() 只是让首指针后移一位
+ * 所以拷贝只需复制首指针并增加一次引用计数，时间为O(1)
+ * 拷贝得到的就是一份快照：之后对原链表的 push_front()/pop_front() 不会影响它
+ *
+ * 线程安全性与 std::shared_ptr 相同：
+ * 共享节点的不同 PersistentList 对象可以在不同线程中同时读写，无需加锁
+ * 同一个对象同时被读写时需要外部同步
+ * 典型用法是写线程在锁内更新一个"当前版本"，读线程在锁内拷贝一份后，在锁外随意遍历
+ *
+ * 与LinkedList相比：元素只读、只能在头部增删；LinkedList的拷贝是O(n)的深拷贝
+ *
+ * 用法：
+ * @code
+ * PersistentList<int> v1 = {2, 3};
+ * PersistentList<int> v2 = v1; // O(1)
+ * v2.push_front(1);            // v2: 1 2 3，v1仍为 2 3，两者共享2和3的节点
+ * @endcode
+ *
+ * @note 节点在最后一个引用它的链表销毁时释放，分配器需要能在任何一个持有者所在的线程中释放
+ *
+ * @author neOzkyol
+ * @date 2026-01-20
+ * @version 1.0
+ */
+#include <atomic> ///< std::atomic
+#include <cstddef> ///< std::ptrdiff_t std::size_t
+#include <initializer_list> ///< std::initializer_list
+#include <iterator> ///< std::forward_iterator_tag
+#include <memory> ///< std::allocator std::allocator_traits
+#include <new> ///< placement new
+#include <stdexcept> ///< std::logic_error
+#include <type_traits> ///< std::enable_if std::is_integral
+#include <utility> ///< std::move std::forward std::swap
+/**
+ * @tparam DataType 链表存储的数据类型
+ * @tparam Allocator 分配器，内部重绑定到节点
+ *
+ * 共享节点的各个链表都持有分配器的副本，由最后一个持有者释放节点
+ * 所以拷贝和赋值时分配器总是随节点一起复制
+ */
+template<typename DataType, typename Allocator = std::allocator<DataType>>
+class PersistentList {
+private:
+        /**
+         * @brief 不可变的链表节点
+         *
+         */
+        struct Node {
+                mutable std::atomic<std::size_t> _refs; ///< 引用此节点的链表和节点的个数
+                const Node* _next; ///< 下一个节点，此节点持有它的一个引用
+                const DataType _data; ///< 数据
+                template<typename... Args>
+                Node(const Node* next, Args&&... args): _refs(1), _next(next), _data(std::forward<Args>(args)...){}
+        };
+        using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+        using NodeAllocTraits = std::allocator_traits<NodeAllocator>;
+
+        const Node* _head; ///< 首节点，此链表持有它的一个引用
+        int _length; ///< 链表的长度
+        NodeAllocator _alloc; ///< 节点通过它分配和释放
+
+        /**
+         * @brief 增加一次引用
+         *
+         * @param node 节点，可以为 nullptr
+         */
+        static void retain(const Node* node) noexcept {
+                if(node != nullptr) {
+                        node -> _refs.fetch_add(1, std::memory_order_relaxed);
+                }
+        }
+        /**
+         * @brief 减少一次引用，降到0时销毁节点并继续释放它对下一个节点的引用
+         *
+         * 循环而不是递归，释放很长的链也不会栈溢出
+         * 遇到仍被其他链表引用的节点就停下
+         *
+         * @param node 节点，可以为 nullptr
+         * @note 时间：O(释放的节点数), 空间：O(1)
+         */
+        void release(const Node* node) noexcept {
+                while(node != nullptr && node -> _refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                        const Node* next = node -> _next;
+                        Node* target = const_cast<Node*>(node);
+                        NodeAllocTraits::destroy(_alloc, target);
+                        NodeAllocTraits::deallocate(_alloc, target, 1);
+                        node = next;
+                }
+        }
+        /**
+         * @brief 创建一个节点
+         *
+         * 构造抛出异常时释放内存，next的引用不受影响
+         *
+         * @param next 下一个节点，新节点接管调用者对它的一个引用
+         * @param args 转发给DataType构造函数的参数
+         * @return 新节点，引用计数为1
+         */
+        template<typename... Args>
+        Node* createNode(const Node* next, Args&&... args) {
+                Node* node = NodeAllocTraits::allocate(_alloc, 1);
+                try {
+                        NodeAllocTraits::construct(_alloc, node, next, std::forward<Args>(args)...);
+                } catch(...) {
+                        NodeAllocTraits::deallocate(_alloc, node, 1);
+                        throw;
+                }
+                return node;
+        }
+        /**
+         * @brief 按顺序用一个范围建链
+         *
+         * 链表内部自用函数，此链表需为空
+         * 建链期间节点还没有被共享，可以直接修改_next接到尾部
+         * 抛出异常时已建的节点全部释放，链表仍为空
+         *
+         * @param first 范围起点
+         * @param last 范围终点
+         */
+        template<typename InputIt>
+        void build(InputIt first, InputIt last) {
+                Node* tail = nullptr;
+                try {
+                        for(; first != last; ++first) {
+                                Node* node = createNode(nullptr, *first);
+                                if(tail == nullptr) {
+                                        _head = node;
+                                } else {
+                                        tail -> _next = node;
+                                }
+                                tail = node;
+                                _length++;
+                        }
+                } catch(...) {
+                        clean();
+                        throw;
+                }
+        }
+        /**
+         * @brief 直接用已持有引用的节点构造
+         *
+         * @param head 首节点，新链表接管调用者对它的一个引用
+         * @param length 长度
+         * @param alloc 分配器
+         */
+        PersistentList(const Node* head, int length, const NodeAllocator& alloc) noexcept:
+                _head(head), _length(length), _alloc(alloc) {}
+public:
+        using allocator_type = Allocator; ///< 对接STL
+        /**
+         * @name 链表构造函数
+         * @{
+         */
+
+        /**
+         * @brief 无参构造函数
+         *
+         */
+        PersistentList() noexcept(std::is_nothrow_default_constructible<NodeAllocator>::value):
+                _head(nullptr), _length(0), _alloc() {}
+        /**
+         * @brief 指定分配器的构造函数
+         *
+         * @param alloc 要使用的分配器
+         */
+        explicit PersistentList(const Allocator& alloc): _head(nullptr), _length(0), _alloc(alloc) {}
+        /**
+         * @brief 迭代器范围构造函数
+         *
+         * @param first 范围起点
+         * @param last 范围终点
+         * @param alloc 要使用的分配器
+         * @note 时间：O(n), 空间：O(n)
+         */
+        template<typename InputIt, typename = typename std::enable_if<!std::is_integral<InputIt>::value>::type>
+        PersistentList(InputIt first, InputIt last, const Allocator& alloc = Allocator()):
+                _head(nullptr), _length(0), _alloc(alloc) {
+                build(first, last);
+        }
+        /**
+         * @brief 初始化列表构造函数
+         *
+         * @param init 初始元素
+         * @param alloc 要使用的分配器
+         * @note 时间：O(n), 空间：O(n)
+         */
+        PersistentList(std::initializer_list<DataType> init, const Allocator& alloc = Allocator()):
+                _head(nullptr), _length(0), _alloc(alloc) {
+                build(init.begin(), init.end());
+        }
+        /**
+         * @brief 拷贝构造函数
+         *
+         * 与other共享全部节点，只增加首节点的引用计数
+         *
+         * @param other 被拷贝的链表
+         * @note 时间：O(1), 空间：O(1)
+         */
+        PersistentList(const PersistentList& other) noexcept:
+                _head(other._head), _length(other._length), _alloc(other._alloc) {
+                retain(_head);
+        }
+        /**
+         * @brief 移动构造函数
+         *
+         * 接管other对首节点的引用，other随后为空
+         *
+         * @param other 被移动的链表
+         * @note 时间：O(1), 空间：O(1)
+         */
+        PersistentList(PersistentList&& other) noexcept:
+                _head(other._head), _length(other._length), _alloc(other._alloc) {
+                other._head = nullptr;
+                other._length = 0;
+        }
+        /**
+         * @brief 拷贝赋值函数
+         *
+         * 先增加other的引用再释放自己原有的，自赋值也正确
+         *
+         * @param other 被拷贝的链表
+         * @return 当前链表
+         * @note 时间：O(1)，另加释放不再被引用的节点, 空间：O(1)
+         */
+        PersistentList& operator=(const PersistentList& other) noexcept {
+                retain(other._head);
+                release(_head);
+                _head = other._head;
+                _length = other._length;
+                _alloc = other._alloc;
+                return *this;
+        }
+        /**
+         * @brief 移动赋值函数
+         *
+         * @param other 被移动的链表
+         * @return 当前链表
+         * @note 时间：O(1)，另加释放不再被引用的节点, 空间：O(1)
+         */
+        PersistentList& operator=(PersistentList&& other) noexcept {
+                if(this != &other) {
+                        release(_head);
+                        _head = other._head;
+                        _length = other._length;
+                        _alloc = other._alloc;
+                        other._head = nullptr;
+                        other._length = 0;
+                }
+                return *this;
+        }
+        /** @} */
+        /**
+         * @brief 析构函数
+         *
+         * 释放对首节点的引用，只销毁不再被任何链表引用的节点
+         *
+         * @sa clean()
+         */
+        ~PersistentList() {
+                release(_head);
+        }
+        /**
+         * @brief 获取分配器
+         *
+         * @return 由_alloc重绑定回DataType得到的分配器副本
+         */
+        allocator_type get_allocator() const {
+                return allocator_type(_alloc);
+        }
+        /**
+         * @brief 与other交换内容
+         *
+         * @param other 另一个链表
+         * @note 时间：O(1), 空间：O(1)
+         */
+        void swap(PersistentList& other) noexcept {
+                using std::swap;
+                swap(_head, other._head);
+                swap(_length, other._length);
+                swap(_alloc, other._alloc);
+        }
+
+        /**
+         * @class ConstIterator
+         * @brief PersistentList的迭代器，元素不可修改
+         *
+         * 只要迭代器所在的链表(或任何共享这些节点的链表)还活着，迭代器就有效
+         * 之后的 push_front()/pop_front() 不会使它失效
+         *
+         */
+        class ConstIterator {
+        private:
+                const Node* _curr; ///< 迭代器当前指向的节点
+                friend class PersistentList; ///< 使PersistentList能访问ConstIterator私有成员
+        public:
+                /**
+                 * @brief 对接STL
+                 * @{
+                 */
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = DataType;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const DataType*;
+                using reference = const DataType&;
+                /** @} */
+                explicit ConstIterator(const Node* node = nullptr) noexcept: _curr(node){}
+                const DataType& operator*() const noexcept {
+                        return _curr -> _data;
+                }
+                const DataType* operator->() const noexcept {
+                        return &(_curr -> _data);
+                }
+                ConstIterator& operator++() noexcept {
+                        _curr = _curr -> _next;
+                        return *this;
+                }
+                ConstIterator operator++(int) noexcept {
+                        auto temp = *this;
+                        _curr = _curr -> _next;
+                        return temp;
+                }
+                bool operator==(const ConstIterator& other) const noexcept {
+                        return _curr == other._curr;
+                }
+                bool operator!=(const ConstIterator& other) const noexcept {
+                        return !(*this == other);
+                }
+        }; ///< class ConstIterator
+        using Iterator = ConstIterator; ///< 元素不可修改，Iterator与ConstIterator相同
+
+        /**
+         * @name 迭代器
+         * @{
+         */
+        ConstIterator begin() const noexcept {
+                return ConstIterator(_head);
+        }
+        ConstIterator cbegin() const noexcept {
+                return ConstIterator(_head);
+        }
+        ConstIterator end() const noexcept {
+                return ConstIterator(nullptr);
+        }
+        ConstIterator cend() const noexcept {
+                return ConstIterator(nullptr);
+        }
+        /** @} */
+
+        /**
+         * @brief 获取链表长度
+         *
+         * @return _length成员
+         */
+        int size() const noexcept {
+                return _length;
+        }
+        /**
+         * @brief 判断链表是否为空
+         *
+         * @retval true 链表为空
+         * @retval false 反之
+         */
+        bool empty() const noexcept {
+                return _head == nullptr;
+        }
+        /**
+         * @brief 判断两个链表是否共享同一个首节点
+         *
+         * 为true时两者内容一定相同，可以代替逐个比较
+         *
+         * @param other 另一个链表
+         * @retval true 共享首节点(或都为空)
+         * @retval false 反之
+         * @note 时间：O(1), 空间：O(1)
+         */
+        bool shares_with(const PersistentList& other) const noexcept {
+                return _head == other._head;
+        }
+        /**
+         * @brief 获取头元素
+         *
+         * 链表为空会抛出异常
+         *
+         * @return 头元素的const引用
+         */
+        const DataType& front() const {
+                if(empty()) {
+                        throw std::logic_error("PersistentList is empty");
+                }
+                return _head -> _data;
+        }
+        /**
+         * @brief 获取去掉头元素后的链表
+         *
+         * 与此链表共享除首节点外的全部节点
+         * 链表为空会抛出异常
+         *
+         * @return 新链表
+         * @note 时间：O(1), 空间：O(1)
+         */
+        PersistentList rest() const {
+                if(empty()) {
+                        throw std::logic_error("PersistentList is empty");
+                }
+                retain(_head -> _next);
+                return PersistentList(_head -> _next, _length - 1, _alloc);
+        }
+
+        /**
+         * @name 头插入
+         * @brief 新建一个首节点指向原来的首节点
+         *
+         * 原来的节点不变，仍与其他副本共享
+         * 构造抛出异常时链表不变
+         *
+         * @param data 要插入的数据
+         * @note 时间：O(1), 空间：O(1)
+         * @{
+         */
+        void push_front(const DataType& data) {
+                emplace_front(data);
+        }
+        void push_front(DataType&& data) {
+                emplace_front(std::move(data));
+        }
+        /** @} */
+        /**
+         * @brief 在头部原地构造
+         *
+         * @param args 转发给DataType构造函数的参数
+         * @return 新元素的const引用
+         * @note 时间：O(1), 空间：O(1)
+         */
+        template<typename... Args>
+        const DataType& emplace_front(Args&&... args) {
+                _head = createNode(_head, std::forward<Args>(args)...);
+                _length++;
+                return _head -> _data;
+        }
+        /**
+         * @brief 头删除
+         *
+         * 首指针后移一位，原首节点只在没有其他副本引用时销毁
+         * 链表为空时抛出异常
+         *
+         * @note 时间：O(1), 空间：O(1)
+         */
+        void pop_front() {
+                if(empty()) {
+                        throw std::logic_error("cannot pop from empty list");
+                }
+                const Node* old = _head;
+                _head = old -> _next;
+                retain(_head);
+                _length--;
+                release(old);
+        }
+        /**
+         * @brief 清空链表
+         *
+         * 只释放此链表的引用，其他副本不受影响
+         *
+         * @note 时间：O(不再被引用的节点数), 空间：O(1)
+         */
+        void clean() noexcept {
+                release(_head);
+                _head = nullptr;
+                _length = 0;
+        }
+        /**
+         * @name 查找
+         * @{
+         */
+
+        /**
+         * @brief 寻找第一个等于data的元素
+         *
+         * @param data 要寻找的数据
+         * @return 找到的迭代器，未找到时为end()
+         * @note 时间：O(n), 空间：O(1)
+         */
+        ConstIterator find(const DataType& data) const {
+                const Node* curr = _head;
+                while(curr != nullptr && !(curr -> _data == data)) {
+                        curr = curr -> _next;
+                }
+                return ConstIterator(curr);
+        }
+        /**
+         * @brief 判断是否存在等于data的元素
+         *
+         * @param data 要寻找的数据
+         * @retval true 存在
+         * @retval false 不存在
+         * @note 时间：O(n), 空间：O(1)
+         */
+        bool contains(const DataType& data) const {
+                return find(data) != cend();
+        }
+        /** @} */
+}; ///< class PersistentList
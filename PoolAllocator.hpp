@@ -0,0 +1,434 @@
+#pragma once
+/**
+ * @file PoolAllocator.hpp
+ * @class PoolAllocator
+ * @brief 一个给链表节点用的池分配器
+ *
+ * 节点从一整块连续的内存(chunk)中切出来
+ * 释放的节点挂到空闲链表上，下次分配优先复用
+ * 所以频繁 push/pop 的场景基本不会再碰系统堆
+ *
+ * 用法：
+ * @code
+ * LinkedList<int, PoolAllocator<int>> l;
+ * @endcode
+ *
+ * @note 不是线程安全的，一个池同一时间只能被一个线程使用
+ *
+ * @author neOzkyol
+ * @date 2026-01-17
+ * @version 1.0
+ */
+#include <cstddef> ///< std::size_t std::max_align_t
+#include <new> ///< ::operator new ::operator delete
+#include <memory> ///< std::shared_ptr
+#include <type_traits> ///< std::true_type
+#include <vector> ///< std::vector
+/**
+ * @class NodePool
+ * @brief 固定大小内存块的池
+ *
+ * PoolAllocator的实现细节
+ * 不关心存放的类型，只关心块的大小
+ *
+ */
+class NodePool {
+private:
+        struct FreeBlock { ///< 空闲块，复用块本身的内存做链表
+                FreeBlock* _next; ///< 下一个空闲块
+        };
+        struct Chunk { ///< 一次向系统申请的大块内存的头部
+                Chunk* _next; ///< 上一次申请的大块
+        };
+        std::size_t _blockSize; ///< 每个块的大小，已按对齐取整
+        std::size_t _blocksPerChunk; ///< 每个大块能切出的块数
+        FreeBlock* _freeList; ///< 空闲链表
+        char* _cursor; ///< 当前大块中下一个未用过的块
+        char* _end; ///< 当前大块的末尾
+        Chunk* _chunks; ///< 所有大块，析构时统一释放
+        std::size_t _reserved; ///< reserve()之后还有多少次allocate()要从当前大块连续切出
+        /**
+         * @brief 向系统申请一个新的大块
+         *
+         * 大块头部放Chunk，其后是连续的块
+         * 可能抛出 std::bad_alloc
+         *
+         * @param blocks 这个大块要切出的块数
+         */
+        void grow(std::size_t blocks) {
+                const std::size_t header = roundUp(sizeof(Chunk));
+                char* raw = static_cast<char*>(::operator new(header + blocks * _blockSize));
+                Chunk* chunk = reinterpret_cast<Chunk*>(raw);
+                chunk -> _next = _chunks;
+                _chunks = chunk;
+                _cursor = raw + header;
+                _end = _cursor + blocks * _blockSize;
+        }
+public:
+        /**
+         * @brief 把块大小向上取整到对齐的倍数
+         *
+         * @param size 原始大小
+         * @return 取整后的大小，至少能放下一个FreeBlock
+         */
+        static std::size_t roundUp(std::size_t size) noexcept {
+                const std::size_t align = alignof(std::max_align_t);
+                if(size < sizeof(FreeBlock)) {
+                        size = sizeof(FreeBlock);
+                }
+                return (size + align - 1) / align * align;
+        }
+        /**
+         * @brief 构造函数
+         *
+         * 不会立即申请内存，第一次allocate()时才申请
+         *
+         * @param blockSize 每个块的大小
+         * @param blocksPerChunk 每个大块能切出的块数
+         */
+        NodePool(std::size_t blockSize, std::size_t blocksPerChunk) noexcept:
+                _blockSize(roundUp(blockSize)), _blocksPerChunk(blocksPerChunk == 0? 1: blocksPerChunk),
+                _freeList(nullptr), _cursor(nullptr), _end(nullptr), _chunks(nullptr), _reserved(0) {}
+        /**
+         * @brief 获取块的大小
+         *
+         * @return 已按对齐取整的块大小
+         */
+        std::size_t blockSize() const noexcept {
+                return _blockSize;
+        }
+        NodePool(const NodePool&) = delete;
+        NodePool& operator=(const NodePool&) = delete;
+        /**
+         * @brief 析构函数
+         *
+         * 一次性归还所有大块
+         * 不会调用块中对象的析构函数
+         *
+         */
+        ~NodePool() noexcept {
+                release();
+        }
+        /**
+         * @brief 归还所有大块
+         *
+         * 之后池回到刚构造时的状态，之前分配的块全部失效
+         * 不会调用块中对象的析构函数
+         * 按申请的先后顺序归还：倒序归还时每次都与堆顶合并，系统堆会反复收缩
+         *
+         * @note 时间：O(大块数), 空间：O(1)
+         */
+        void release() noexcept {
+                Chunk* oldest = nullptr;
+                while(_chunks != nullptr) {
+                        auto temp = _chunks;
+                        _chunks = _chunks -> _next;
+                        temp -> _next = oldest;
+                        oldest = temp;
+                }
+                while(oldest != nullptr) {
+                        auto temp = oldest;
+                        oldest = oldest -> _next;
+                        ::operator delete(temp);
+                }
+                _freeList = nullptr;
+                _cursor = nullptr;
+                _end = nullptr;
+                _reserved = 0;
+        }
+        /**
+         * @brief 分配一个块
+         *
+         * 优先从空闲链表取，其次从当前大块切，都没有时申请新的大块
+         * reserve()预留的块用完之前跳过空闲链表
+         *
+         * @return 块的地址
+         * @note 时间：均摊O(1)
+         */
+        void* allocate() {
+                if(_reserved > 0) {
+                        _reserved--;
+                } else if(_freeList != nullptr) {
+                        auto block = _freeList;
+                        _freeList = block -> _next;
+                        return block;
+                }
+                if(_cursor == _end) {
+                        grow(_blocksPerChunk);
+                }
+                void* block = _cursor;
+                _cursor += _blockSize;
+                return block;
+        }
+        /**
+         * @brief 预留块
+         *
+         * 保证之后的n次allocate()不再向系统申请内存，并且从同一大块中按地址顺序连续切出
+         * 当前大块剩余的块不够时，把剩余的块挂到空闲链表上，再一次申请至少n块的新大块
+         * 这n次分配不使用空闲链表，其中的块留给之后的分配
+         *
+         * @param n 需要的块数
+         * @note 时间：O(当前大块剩余的块数)
+         */
+        void reserve(std::size_t n) {
+                std::size_t remaining = static_cast<std::size_t>(_end - _cursor) / _blockSize;
+                if(remaining < n) {
+                        char* oldCursor = _cursor;
+                        grow(n > _blocksPerChunk? n: _blocksPerChunk);
+                        for(std::size_t i = 0; i < remaining; i++) {
+                                deallocate(oldCursor + i * _blockSize);
+                        }
+                }
+                _reserved = n;
+        }
+        /**
+         * @brief 结束预留
+         *
+         * reserve()预留的块没有用完(如批量插入中途抛出异常)时，之后的allocate()仍会跳过空闲链表
+         * 批量分配结束或失败后调用，恢复优先复用空闲块，剩余的块留在当前大块中照常切出
+         *
+         * @note 时间：O(1), 空间：O(1)
+         */
+        void unreserve() noexcept {
+                _reserved = 0;
+        }
+        /**
+         * @brief 归还一个块
+         *
+         * 挂到空闲链表头部，不还给系统
+         *
+         * @param block 由allocate()得到的块
+         * @note 时间：O(1), 空间：O(1)
+         */
+        void deallocate(void* block) noexcept {
+                auto freeBlock = static_cast<FreeBlock*>(block);
+                freeBlock -> _next = _freeList;
+                _freeList = freeBlock;
+        }
+}; ///< class NodePool
+
+/**
+ * @class NodePoolSet
+ * @brief 按块大小区分的一组NodePool
+ *
+ * PoolAllocator的实现细节
+ * 同一个分配器重绑定到不同类型后仍共享这一组池
+ * 所以重绑定前后的分配器相等，可以互相释放对方分配的内存
+ *
+ */
+class NodePoolSet {
+private:
+        std::vector<std::unique_ptr<NodePool>> _pools; ///< 每种块大小一个池，种类很少，线性查找即可
+public:
+        /**
+         * @brief 获取指定大小的池，没有时创建
+         *
+         * @param size 对象大小
+         * @param blocksPerChunk 新建池时每个大块的块数
+         * @return 池的引用
+         */
+        NodePool& get(std::size_t size, std::size_t blocksPerChunk) {
+                const std::size_t blockSize = NodePool::roundUp(size);
+                for(auto& pool : _pools) {
+                        if(pool -> blockSize() == blockSize) {
+                                return *pool;
+                        }
+                }
+                _pools.emplace_back(new NodePool(blockSize, blocksPerChunk));
+                return *_pools.back();
+        }
+        /**
+         * @brief 归还所有池的全部大块
+         *
+         * @sa NodePool::release()
+         */
+        void release() noexcept {
+                for(auto& pool : _pools) {
+                        pool -> release();
+                }
+        }
+}; ///< class NodePoolSet
+
+/**
+ * @tparam T 分配的对象类型
+ * @tparam ChunkSize 每个大块包含的对象个数
+ *
+ * 单个对象的分配走池，数组分配(n != 1)直接走 ::operator new
+ * 拷贝和重绑定得到的分配器都与原分配器共享同一组池
+ * 例如 LinkedList<T, PoolAllocator<T>> b(a.get_allocator()) 与 a 共享池
+ */
+template<typename T, std::size_t ChunkSize = 256>
+class PoolAllocator {
+private:
+        template<typename U, std::size_t N>
+        friend class PoolAllocator; ///< 使不同类型的PoolAllocator能互相访问
+        /**
+         * @brief 共享的一组池
+         *
+         * 构造时创建，之后永不为空
+         * 所以拷贝只复制共享指针，不会抛出异常，相等关系也不会在分配之后改变
+         *
+         */
+        std::shared_ptr<NodePoolSet> _pools;
+        mutable NodePool* _pool; ///< _pools中对应sizeof(T)的池，缓存查找结果
+        static_assert(alignof(T) <= alignof(std::max_align_t), "PoolAllocator does not support over-aligned types");
+        /**
+         * @brief 获取sizeof(T)对应的池，必要时创建
+         *
+         * @return 池的引用
+         */
+        NodePool& pool() const {
+                if(_pool == nullptr) {
+                        _pool = &_pools -> get(sizeof(T), ChunkSize);
+                }
+                return *_pool;
+        }
+public:
+        /**
+         * @brief 对接STL
+         * @{
+         */
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using propagate_on_container_copy_assignment = std::false_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+        template<typename U>
+        struct rebind {
+                using other = PoolAllocator<U, ChunkSize>;
+        };
+        /** @} */
+
+        /**
+         * @brief 无参构造函数
+         *
+         * 创建一组新的空池，第一次分配时才申请大块内存
+         * 可能抛出 std::bad_alloc
+         *
+         */
+        PoolAllocator(): _pools(std::make_shared<NodePoolSet>()), _pool(nullptr) {}
+        /**
+         * @brief 拷贝构造函数
+         *
+         * 与other共享同一组池
+         * 没有单独的移动构造和移动赋值：按分配器的要求，被移动的分配器必须保持原值，移动与拷贝相同
+         *
+         * @param other 被拷贝的分配器
+         */
+        PoolAllocator(const PoolAllocator& other) noexcept: _pools(other._pools), _pool(other._pool) {}
+        /**
+         * @brief 重绑定构造函数
+         *
+         * 与other共享同一组池，sizeof(T)对应的池等到分配时再查找
+         *
+         * @param other 被重绑定的分配器
+         */
+        template<typename U>
+        PoolAllocator(const PoolAllocator<U, ChunkSize>& other) noexcept: _pools(other._pools), _pool(nullptr) {}
+        PoolAllocator& operator=(const PoolAllocator& other) noexcept {
+                _pools = other._pools;
+                _pool = other._pool;
+                return *this;
+        }
+        /**
+         * @brief 容器拷贝时使用的分配器
+         *
+         * 每个容器拥有自己的池，互不干扰
+         *
+         * @return 一个新的分配器
+         */
+        PoolAllocator select_on_container_copy_construction() const {
+                return PoolAllocator();
+        }
+        /**
+         * @brief 分配n个T的内存
+         *
+         * @param n 个数
+         * @return 内存的首地址
+         * @note 时间：均摊O(1)
+         */
+        T* allocate(std::size_t n) {
+                if(n == 1) {
+                        return static_cast<T*>(pool().allocate());
+                }
+                return static_cast<T*>(::operator new(n * sizeof(T)));
+        }
+        /**
+         * @brief 预留n个T的空间
+         *
+         * 之后的n次单个对象分配都不再访问系统堆，并且在同一大块中连续排列
+         * LinkedList批量插入和compact()时通过它一次申请整批节点的内存
+         *
+         * @param n 个数
+         * @note 时间：O(ChunkSize)
+         */
+        void reserve(std::size_t n) {
+                pool().reserve(n);
+        }
+        /**
+         * @brief 结束reserve()的预留
+         *
+         * LinkedList在批量插入和compact()结束或失败时调用
+         *
+         * @sa NodePool::unreserve()
+         */
+        void unreserve() noexcept {
+                if(_pool != nullptr) {
+                        _pool -> unreserve();
+                }
+        }
+        /**
+         * @brief 归还n个T的内存
+         *
+         * @param p allocate()得到的地址
+         * @param n allocate()时的个数
+         * @note 时间：O(1), 空间：O(1)
+         */
+        void deallocate(T* p, std::size_t n) noexcept {
+                if(n == 1) {
+                        pool().deallocate(p);
+                        return;
+                }
+                ::operator delete(p);
+        }
+        /**
+         * @brief 一次性归还整组池的内存
+         *
+         * 只有当此分配器是这组池唯一的持有者时才执行，否则什么也不做
+         * 调用者需保证不再使用从池中分配的任何对象，且它们不需要析构
+         * LinkedList清空平凡析构类型的链表时通过它跳过逐个节点的释放
+         *
+         * @retval true 已归还
+         * @retval false 还有其他分配器共享这组池，未做任何事
+         * @note 时间：O(大块数)
+         */
+        bool release_all() noexcept {
+                if(_pools.use_count() != 1) {
+                        return false;
+                }
+                _pools -> release();
+                return true;
+        }
+        /**
+         * @brief ==比较重载
+         *
+         * 共享同一组池时相等
+         *
+         */
+        template<typename U>
+        bool operator==(const PoolAllocator<U, ChunkSize>& other) const noexcept {
+                return _pools == other._pools;
+        }
+        /**
+         * @brief !=比较重载
+         *
+         * 基于==重载
+         *
+         * @sa operator==
+         */
+        template<typename U>
+        bool operator!=(const PoolAllocator<U, ChunkSize>& other) const noexcept {
+                return !(*this == other);
+        }
+}; ///< class PoolAllocator
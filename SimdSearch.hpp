@@ -0,0 +1,342 @@
+#pragma once
+/**
+ * @file SimdSearch.hpp
+ * @class SimdSearch
+ * @brief 在连续数组中查找/计数某个值的向量化内核
+ *
+ * UnrolledLinkedList在每个节点的连续数组上调用它
+ * 对 32/64 位整数、float、double 一次比较多个元素：
+ * - x86 上默认使用SSE2，运行时检测到AVX2时改用AVX2
+ * - 其他平台、其他类型，或定义了 SIMD_SEARCH_SCALAR 时退回逐个 operator== 比较
+ *
+ * 浮点数按 operator== 的语义比较：NaN 不等于任何值，+0.0 等于 -0.0
+ *
+ * @author neOzkyol
+ * @date 2026-01-18
+ * @version 1.0
+ */
+#include <cstdint> ///< std::int32_t std::int64_t
+#include <cstring> ///< std::memcpy
+#include <type_traits> ///< std::integral_constant std::is_integral
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__SSE2__) && !defined(SIMD_SEARCH_SCALAR)
+#define SIMD_SEARCH_X86 1
+#include <immintrin.h> ///< SSE2/AVX2 intrinsics
+#define SIMD_SEARCH_AVX2 __attribute__((target("avx2")))
+#endif
+
+/**
+ * @brief 元素按哪种向量比较
+ */
+enum class SimdLane {
+        None, ///< 不向量化
+        Int32, ///< 按位比较的32位整数
+        Int64, ///< 按位比较的64位整数
+        Float, ///< float
+        Double ///< double
+};
+
+/**
+ * @brief 获取类型对应的SimdLane
+ *
+ * 4字节和8字节的整数类型按位比较，包括wchar_t char32_t等字符类型
+ * bool、其他大小的整数和非算术类型不向量化
+ *
+ * @tparam T 元素类型
+ */
+template<typename T>
+struct SimdLaneOf: std::integral_constant<SimdLane,
+        std::is_same<T, float>::value? SimdLane::Float:
+        std::is_same<T, double>::value? SimdLane::Double:
+        !std::is_integral<T>::value || std::is_same<T, bool>::value? SimdLane::None:
+        sizeof(T) == 4? SimdLane::Int32:
+        sizeof(T) == 8? SimdLane::Int64: SimdLane::None> {};
+
+/**
+ * @tparam T 元素类型
+ * @tparam Lane 比较方式，由SimdLaneOf推导
+ *
+ * 通用版本逐个用 operator== 比较
+ */
+template<typename T, SimdLane Lane = SimdLaneOf<T>::value>
+struct SimdSearch {
+        static const bool Vectorized = false; ///< 是否使用向量指令
+        /**
+         * @brief 寻找第一个等于value的元素
+         *
+         * @param data 数组首地址
+         * @param length 元素个数
+         * @param value 目标值
+         * @retval >=0 找到的下标
+         * @retval -1 未找到
+         * @note 时间：O(length), 空间：O(1)
+         */
+        static int find(const T* data, int length, const T& value) {
+                for(int i = 0; i < length; i++) {
+                        if(data[i] == value) {
+                                return i;
+                        }
+                }
+                return -1;
+        }
+        /**
+         * @brief 统计等于value的元素个数
+         *
+         * @param data 数组首地址
+         * @param length 元素个数
+         * @param value 目标值
+         * @return 个数
+         * @note 时间：O(length), 空间：O(1)
+         */
+        static int count(const T* data, int length, const T& value) {
+                int result = 0;
+                for(int i = 0; i < length; i++) {
+                        if(data[i] == value) {
+                                result++;
+                        }
+                }
+                return result;
+        }
+}; ///< struct SimdSearch
+
+#ifdef SIMD_SEARCH_X86
+/**
+ * @class SimdKernels
+ * @brief SimdSearch的实现细节
+ *
+ * 每组Ops提供：一次比较的元素个数Lanes、load()、splat()
+ * 以及match()，返回每个相等元素一位的掩码
+ *
+ */
+class SimdKernels {
+public:
+        struct Sse2Int32 {
+                using Vec = __m128i;
+                static const int Lanes = 4;
+                static Vec load(const void* p) noexcept {
+                        return _mm_loadu_si128(static_cast<const __m128i*>(p));
+                }
+                static Vec splat(const void* p) noexcept {
+                        std::int32_t v;
+                        std::memcpy(&v, p, sizeof(v));
+                        return _mm_set1_epi32(v);
+                }
+                static int match(Vec a, Vec b) noexcept {
+                        return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b)));
+                }
+        };
+        /**
+         * @brief SSE2没有64位整数比较
+         *
+         * 先按32位比较，再与交换高低半部分的结果相与
+         *
+         */
+        struct Sse2Int64 {
+                using Vec = __m128i;
+                static const int Lanes = 2;
+                static Vec load(const void* p) noexcept {
+                        return _mm_loadu_si128(static_cast<const __m128i*>(p));
+                }
+                static Vec splat(const void* p) noexcept {
+                        long long v;
+                        std::memcpy(&v, p, sizeof(v));
+                        return _mm_set1_epi64x(v);
+                }
+                static int match(Vec a, Vec b) noexcept {
+                        __m128i eq = _mm_cmpeq_epi32(a, b);
+                        eq = _mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1)));
+                        return _mm_movemask_pd(_mm_castsi128_pd(eq));
+                }
+        };
+        struct Sse2Float {
+                using Vec = __m128;
+                static const int Lanes = 4;
+                static Vec load(const void* p) noexcept {
+                        return _mm_loadu_ps(static_cast<const float*>(p));
+                }
+                static Vec splat(const void* p) noexcept {
+                        return _mm_set1_ps(*static_cast<const float*>(p));
+                }
+                static int match(Vec a, Vec b) noexcept {
+                        return _mm_movemask_ps(_mm_cmpeq_ps(a, b));
+                }
+        };
+        struct Sse2Double {
+                using Vec = __m128d;
+                static const int Lanes = 2;
+                static Vec load(const void* p) noexcept {
+                        return _mm_loadu_pd(static_cast<const double*>(p));
+                }
+                static Vec splat(const void* p) noexcept {
+                        return _mm_set1_pd(*static_cast<const double*>(p));
+                }
+                static int match(Vec a, Vec b) noexcept {
+                        return _mm_movemask_pd(_mm_cmpeq_pd(a, b));
+                }
+        };
+        struct Avx2Int32 {
+                using Vec = __m256i;
+                static const int Lanes = 8;
+                SIMD_SEARCH_AVX2 static Vec load(const void* p) noexcept {
+                        return _mm256_loadu_si256(static_cast<const __m256i*>(p));
+                }
+                SIMD_SEARCH_AVX2 static Vec splat(const void* p) noexcept {
+                        std::int32_t v;
+                        std::memcpy(&v, p, sizeof(v));
+                        return _mm256_set1_epi32(v);
+                }
+                SIMD_SEARCH_AVX2 static int match(Vec a, Vec b) noexcept {
+                        return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b)));
+                }
+        };
+        struct Avx2Int64 {
+                using Vec = __m256i;
+                static const int Lanes = 4;
+                SIMD_SEARCH_AVX2 static Vec load(const void* p) noexcept {
+                        return _mm256_loadu_si256(static_cast<const __m256i*>(p));
+                }
+                SIMD_SEARCH_AVX2 static Vec splat(const void* p) noexcept {
+                        long long v;
+                        std::memcpy(&v, p, sizeof(v));
+                        return _mm256_set1_epi64x(v);
+                }
+                SIMD_SEARCH_AVX2 static int match(Vec a, Vec b) noexcept {
+                        return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(a, b)));
+                }
+        };
+        struct Avx2Float {
+                using Vec = __m256;
+                static const int Lanes = 8;
+                SIMD_SEARCH_AVX2 static Vec load(const void* p) noexcept {
+                        return _mm256_loadu_ps(static_cast<const float*>(p));
+                }
+                SIMD_SEARCH_AVX2 static Vec splat(const void* p) noexcept {
+                        return _mm256_set1_ps(*static_cast<const float*>(p));
+                }
+                SIMD_SEARCH_AVX2 static int match(Vec a, Vec b) noexcept {
+                        return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ));
+                }
+        };
+        struct Avx2Double {
+                using Vec = __m256d;
+                static const int Lanes = 4;
+                SIMD_SEARCH_AVX2 static Vec load(const void* p) noexcept {
+                        return _mm256_loadu_pd(static_cast<const double*>(p));
+                }
+                SIMD_SEARCH_AVX2 static Vec splat(const void* p) noexcept {
+                        return _mm256_set1_pd(*static_cast<const double*>(p));
+                }
+                SIMD_SEARCH_AVX2 static int match(Vec a, Vec b) noexcept {
+                        return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ));
+                }
+        };
+        /**
+         * @brief CPU是否支持AVX2
+         *
+         * 只检测一次
+         *
+         */
+        static bool hasAvx2() noexcept {
+                static const bool supported = [] {
+                        __builtin_cpu_init();
+                        return __builtin_cpu_supports("avx2") != 0;
+                }();
+                return supported;
+        }
+        /**
+         * @name 扫描数组
+         * @brief CountAll为false时返回第一个相等元素的下标(未找到为-1)，为true时返回相等元素个数
+         *
+         * 两个版本的函数体相同，只是AVX2版本需要带target属性才能内联AVX2的Ops
+         * 不足一个向量的尾部逐个比较
+         *
+         * @{
+         */
+        template<typename Ops, bool CountAll, typename T>
+        static int scanSse2(const T* data, int length, const T& value) noexcept {
+                const typename Ops::Vec key = Ops::splat(&value);
+                int result = 0;
+                int i = 0;
+                for(; i + Ops::Lanes <= length; i += Ops::Lanes) {
+                        const int mask = Ops::match(Ops::load(data + i), key);
+                        if(CountAll) {
+                                result += __builtin_popcount(mask);
+                        } else if(mask != 0) {
+                                return i + __builtin_ctz(mask);
+                        }
+                }
+                for(; i < length; i++) {
+                        if(data[i] == value) {
+                                if(!CountAll) {
+                                        return i;
+                                }
+                                result++;
+                        }
+                }
+                return CountAll? result: -1;
+        }
+        template<typename Ops, bool CountAll, typename T>
+        SIMD_SEARCH_AVX2 static int scanAvx2(const T* data, int length, const T& value) noexcept {
+                const typename Ops::Vec key = Ops::splat(&value);
+                int result = 0;
+                int i = 0;
+                for(; i + Ops::Lanes <= length; i += Ops::Lanes) {
+                        const int mask = Ops::match(Ops::load(data + i), key);
+                        if(CountAll) {
+                                result += __builtin_popcount(mask);
+                        } else if(mask != 0) {
+                                return i + __builtin_ctz(mask);
+                        }
+                }
+                for(; i < length; i++) {
+                        if(data[i] == value) {
+                                if(!CountAll) {
+                                        return i;
+                                }
+                                result++;
+                        }
+                }
+                return CountAll? result: -1;
+        }
+        /** @} */
+}; ///< class SimdKernels
+
+/**
+ * @brief 向量化版本的公共实现
+ *
+ * 数组不足两个AVX2向量时直接用SSE2，省去一次不能内联的函数调用
+ *
+ * @tparam T 元素类型
+ * @tparam Sse2 SSE2的Ops
+ * @tparam Avx2 AVX2的Ops
+ */
+template<typename T, typename Sse2, typename Avx2>
+struct SimdSearchX86 {
+        static const bool Vectorized = true;
+        static int find(const T* data, int length, const T& value) noexcept {
+                if(length >= 2 * Avx2::Lanes && SimdKernels::hasAvx2()) {
+                        return SimdKernels::scanAvx2<Avx2, false>(data, length, value);
+                }
+                return SimdKernels::scanSse2<Sse2, false>(data, length, value);
+        }
+        static int count(const T* data, int length, const T& value) noexcept {
+                if(length >= 2 * Avx2::Lanes && SimdKernels::hasAvx2()) {
+                        return SimdKernels::scanAvx2<Avx2, true>(data, length, value);
+                }
+                return SimdKernels::scanSse2<Sse2, true>(data, length, value);
+        }
+};
+
+/**
+ * @name 各类型的向量化版本
+ * @{
+ */
+template<typename T>
+struct SimdSearch<T, SimdLane::Int32>: SimdSearchX86<T, SimdKernels::Sse2Int32, SimdKernels::Avx2Int32> {};
+template<typename T>
+struct SimdSearch<T, SimdLane::Int64>: SimdSearchX86<T, SimdKernels::Sse2Int64, SimdKernels::Avx2Int64> {};
+template<typename T>
+struct SimdSearch<T, SimdLane::Float>: SimdSearchX86<T, SimdKernels::Sse2Float, SimdKernels::Avx2Float> {};
+template<typename T>
+struct SimdSearch<T, SimdLane::Double>: SimdSearchX86<T, SimdKernels::Sse2Double, SimdKernels::Avx2Double> {};
+/** @} */
+#endif
@@ -0,0 +1,1003 @@
+#pragma once
+/**
+ * @file SlabLinkedList.hpp
+ * @class SlabLinkedList
+ * @brief 节点存放在一整块连续内存(slab)中、用32位下标相连的单向链表
+ *
+ * 所有节点都是slab中的一个槽，槽里是一个32位的下一节点下标和数据
+ * 删除的槽挂到空闲链表上，下次插入优先复用，slab用完时按两倍扩容
+ *
+ * 与LinkedList相比：
+ * - LinkedList<int>的每个节点是8字节指针+4字节数据+4字节填充，另有堆分配的额外开销
+ *   这里每个槽只有4字节下标+4字节数据，小数据类型的内存约减半
+ * - 整个链表只有一次堆分配，节点在内存中挨在一起
+ * - 下标与地址无关，slab可以整体搬移；DataType平凡可拷贝时拷贝构造和扩容都直接memcpy
+ *
+ * 迭代器保存链表指针和下标，slab扩容后仍然有效
+ * 但链表本身被移动后，指向原链表的迭代器失效(LinkedList的迭代器不会)
+ *
+ * 用法：
+ * @code
+ * SlabLinkedList<int> l = {1, 2, 3};
+ * l.reserve(1000); // 之后的1000次插入不再分配内存
+ * @endcode
+ *
+ * @author neOzkyol
+ * @date 2026-01-19
+ * @version 1.0
+ */
+#include <iterator> ///< std::forward_iterator_tag std::iterator_traits std::distance
+#include <cstddef> ///< std::ptrdiff_t std::size_t
+#include <cstdint> ///< std::uint32_t
+#include <cstring> ///< std::memcpy
+#include <climits> ///< INT_MAX
+#include <stdexcept> ///< std::logic_error std::length_error
+#include <memory> ///< std::allocator std::allocator_traits
+#include <new> ///< placement new
+#include <type_traits> ///< std::aligned_storage std::is_trivially_copyable std::enable_if
+#include <utility> ///< std::move std::forward std::move_if_noexcept
+#include <initializer_list> ///< std::initializer_list
+/**
+ * @tparam DataType 链表存储的数据类型
+ * @tparam Allocator 分配器，内部重绑定到槽，整个slab一次分配
+ */
+template<typename DataType, typename Allocator = std::allocator<DataType>>
+class SlabLinkedList {
+private:
+        using Index = std::uint32_t; ///< 槽的下标
+        static const Index NullIndex = 0xFFFFFFFFu; ///< 表示没有下一个节点
+        static const Index BeforeBegin = 0xFFFFFFFEu; ///< before_begin()的下标，对应_head
+        static const Index MaxCapacity = INT_MAX; ///< 槽数上限，与int类型的长度一致
+        static const Index InitialCapacity = 8; ///< 第一次分配的槽数
+        /**
+         * @brief slab中的一个槽
+         *
+         * 使用中时_storage里是一个DataType，_next指向下一个节点
+         * 空闲时_storage未构造，_next指向下一个空闲槽
+         *
+         */
+        struct Slot {
+                Index _next; ///< 下一个节点或下一个空闲槽的下标
+                typename std::aligned_storage<sizeof(DataType), alignof(DataType)>::type _storage; ///< 数据
+        };
+        using SlotAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Slot>;
+        using SlotAllocTraits = std::allocator_traits<SlotAllocator>;
+        using Relocatable = std::is_trivially_copyable<DataType>; ///< 为真时可以按字节拷贝和搬移
+
+        Slot* _slots; ///< slab，未分配时为 nullptr
+        Index _capacity; ///< slab的槽数
+        Index _used; ///< 按顺序用过的槽数，之后的槽从未使用过
+        Index _head; ///< 首节点的下标
+        Index _tail; ///< 尾节点的下标
+        Index _free; ///< 空闲链表的第一个槽
+        int _length; ///< 链表的长度
+        SlotAllocator _alloc; ///< slab通过它分配和释放
+
+        /**
+         * @name 访问槽中的数据
+         * @{
+         */
+        DataType* dataAt(Index index) noexcept {
+                return reinterpret_cast<DataType*>(&_slots[index]._storage);
+        }
+        const DataType* dataAt(Index index) const noexcept {
+                return reinterpret_cast<const DataType*>(&_slots[index]._storage);
+        }
+        /** @} */
+        /**
+         * @name 获取一个位置的"下一个"链接
+         * @brief before_begin()的下一个是_head，其余是槽的_next
+         * @{
+         */
+        Index& linkOf(Index index) noexcept {
+                return index == BeforeBegin? _head: _slots[index]._next;
+        }
+        Index linkOf(Index index) const noexcept {
+                return index == BeforeBegin? _head: _slots[index]._next;
+        }
+        /** @} */
+        /**
+         * @brief 计算扩容后的槽数
+         *
+         * 链表内部自用函数
+         * 超过MaxCapacity时抛出 std::length_error
+         *
+         * @param needed 至少需要的槽数
+         * @return 新的槽数
+         */
+        Index grownCapacity(std::size_t needed) const {
+                if(needed > MaxCapacity) {
+                        throw std::length_error("SlabLinkedList is too long");
+                }
+                std::size_t capacity = _capacity == 0? InitialCapacity: static_cast<std::size_t>(_capacity) * 2;
+                if(capacity < needed) {
+                        capacity = needed;
+                }
+                return static_cast<Index>(capacity > MaxCapacity? MaxCapacity: capacity);
+        }
+        /**
+         * @brief 把所有节点搬到新的slab中，下标不变
+         *
+         * 链表内部自用函数
+         * DataType平凡可拷贝时直接memcpy已用过的槽
+         * 否则复制所有槽的_next，再沿链表逐个移动(移动可能抛出时拷贝)数据
+         * 移动抛出异常时销毁已搬过去的数据，原slab不变(强异常保证)
+         * 成功后原slab中的数据已销毁，但尚未释放
+         *
+         * @param fresh 新的slab，至少有_used个槽
+         */
+        void relocateTo(Slot* fresh) {
+                relocateTo(fresh, Relocatable());
+        }
+        void relocateTo(Slot* fresh, std::true_type) noexcept {
+                if(_used != 0) {
+                        std::memcpy(static_cast<void*>(fresh), static_cast<const void*>(_slots), _used * sizeof(Slot));
+                }
+        }
+        void relocateTo(Slot* fresh, std::false_type) {
+                for(Index i = 0; i < _used; i++) {
+                        fresh[i]._next = _slots[i]._next;
+                }
+                Index moved = _head;
+                try {
+                        for(; moved != NullIndex; moved = _slots[moved]._next) {
+                                ::new(static_cast<void*>(&fresh[moved]._storage)) DataType(std::move_if_noexcept(*dataAt(moved)));
+                        }
+                } catch(...) {
+                        for(Index i = _head; i != moved; i = _slots[i]._next) {
+                                reinterpret_cast<DataType*>(&fresh[i]._storage) -> ~DataType();
+                        }
+                        throw;
+                }
+                for(Index i = _head; i != NullIndex; i = _slots[i]._next) {
+                        dataAt(i) -> ~DataType();
+                }
+        }
+        /**
+         * @brief 换成有capacity个槽的新slab
+         *
+         * 链表内部自用函数
+         * 失败时链表不变
+         *
+         * @param capacity 新的槽数，不少于_used
+         */
+        void reallocate(Index capacity) {
+                Slot* fresh = SlotAllocTraits::allocate(_alloc, capacity);
+                try {
+                        relocateTo(fresh);
+                } catch(...) {
+                        SlotAllocTraits::deallocate(_alloc, fresh, capacity);
+                        throw;
+                }
+                if(_slots != nullptr) {
+                        SlotAllocTraits::deallocate(_alloc, _slots, _capacity);
+                }
+                _slots = fresh;
+                _capacity = capacity;
+        }
+        /**
+         * @brief 在一个空闲槽中构造新元素
+         *
+         * 链表内部自用函数
+         * 优先复用空闲链表中的槽，其次用未用过的槽，都没有时扩容
+         * 扩容时先在新slab中构造新元素，再搬移旧数据
+         * 所以args可以引用链表中的元素(例如 push_back(front()))
+         * 构造抛出异常时链表不变
+         *
+         * @param args 转发给DataType构造函数的参数
+         * @return 新元素所在槽的下标，尚未接入链表
+         */
+        template<typename... Args>
+        Index createNode(Args&&... args) {
+                if(_free != NullIndex) {
+                        const Index index = _free;
+                        ::new(static_cast<void*>(&_slots[index]._storage)) DataType(std::forward<Args>(args)...);
+                        _free = _slots[index]._next;
+                        return index;
+                }
+                if(_used < _capacity) {
+                        ::new(static_cast<void*>(&_slots[_used]._storage)) DataType(std::forward<Args>(args)...);
+                        return _used++;
+                }
+                const Index capacity = grownCapacity(static_cast<std::size_t>(_used) + 1);
+                Slot* fresh = SlotAllocTraits::allocate(_alloc, capacity);
+                try {
+                        ::new(static_cast<void*>(&fresh[_used]._storage)) DataType(std::forward<Args>(args)...);
+                } catch(...) {
+                        SlotAllocTraits::deallocate(_alloc, fresh, capacity);
+                        throw;
+                }
+                try {
+                        relocateTo(fresh);
+                } catch(...) {
+                        reinterpret_cast<DataType*>(&fresh[_used]._storage) -> ~DataType();
+                        SlotAllocTraits::deallocate(_alloc, fresh, capacity);
+                        throw;
+                }
+                if(_slots != nullptr) {
+                        SlotAllocTraits::deallocate(_alloc, _slots, _capacity);
+                }
+                _slots = fresh;
+                _capacity = capacity;
+                return _used++;
+        }
+        /**
+         * @brief 销毁一个节点，把它的槽挂到空闲链表上
+         *
+         * 链表内部自用函数，节点需已从链表中摘下
+         *
+         * @param index 槽的下标
+         */
+        void destroyNode(Index index) noexcept {
+                dataAt(index) -> ~DataType();
+                _slots[index]._next = _free;
+                _free = index;
+        }
+        /**
+         * @brief 把节点接在prev之后
+         *
+         * 链表内部自用函数
+         *
+         * @param prev 前驱的下标，可以是BeforeBegin
+         * @param index 新节点的下标
+         */
+        void linkAfter(Index prev, Index index) noexcept {
+                Index& link = linkOf(prev);
+                _slots[index]._next = link;
+                link = index;
+                if(_slots[index]._next == NullIndex) {
+                        _tail = index;
+                }
+                _length++;
+        }
+        /**
+         * @brief 摘下prev之后的节点
+         *
+         * 链表内部自用函数，prev之后必须有节点
+         *
+         * @param prev 前驱的下标，可以是BeforeBegin
+         * @return 被摘下的节点的下标
+         */
+        Index unlinkAfter(Index prev) noexcept {
+                Index& link = linkOf(prev);
+                const Index index = link;
+                link = _slots[index]._next;
+                if(link == NullIndex) {
+                        _tail = prev == BeforeBegin? NullIndex: prev;
+                }
+                _length--;
+                return index;
+        }
+        /**
+         * @brief 销毁所有元素并释放slab
+         *
+         * 链表内部自用函数
+         *
+         */
+        void release() noexcept {
+                clean();
+                if(_slots != nullptr) {
+                        SlotAllocTraits::deallocate(_alloc, _slots, _capacity);
+                }
+                _slots = nullptr;
+                _capacity = 0;
+        }
+        /**
+         * @brief 接管other的slab，other随后为空且不持有slab
+         *
+         * 链表内部自用函数，此链表需不持有slab，分配器需已处理好
+         *
+         * @param other 被接管的链表
+         */
+        void stealSlab(SlabLinkedList& other) noexcept {
+                _slots = other._slots;
+                _capacity = other._capacity;
+                _used = other._used;
+                _head = other._head;
+                _tail = other._tail;
+                _free = other._free;
+                _length = other._length;
+                other._slots = nullptr;
+                other._capacity = 0;
+                other._used = 0;
+                other._head = NullIndex;
+                other._tail = NullIndex;
+                other._free = NullIndex;
+                other._length = 0;
+        }
+        /**
+         * @brief 按字节复制other的slab
+         *
+         * 链表内部自用函数，此链表需为空且不持有slab
+         * 只用于平凡可拷贝的DataType，下标和空闲链表与other完全相同
+         *
+         * @param other 被复制的链表
+         */
+        void copySlab(const SlabLinkedList& other) {
+                if(other._used == 0) {
+                        return;
+                }
+                _slots = SlotAllocTraits::allocate(_alloc, other._used);
+                _capacity = other._used;
+                std::memcpy(static_cast<void*>(_slots), static_cast<const void*>(other._slots), other._used * sizeof(Slot));
+                _used = other._used;
+                _head = other._head;
+                _tail = other._tail;
+                _free = other._free;
+                _length = other._length;
+        }
+        /**
+         * @brief 拷贝other的全部元素
+         *
+         * 链表内部自用函数，此链表需为空
+         * DataType平凡可拷贝时整块memcpy，否则逐个push_back()，顺便去掉空洞
+         *
+         * @param other 被拷贝的链表
+         */
+        void copyFrom(const SlabLinkedList& other) {
+                copyFrom(other, Relocatable());
+        }
+        void copyFrom(const SlabLinkedList& other, std::true_type) {
+                copySlab(other);
+        }
+        void copyFrom(const SlabLinkedList& other, std::false_type) {
+                reserve(static_cast<std::size_t>(other._length));
+                for(const auto& data : other) {
+                        push_back(data);
+                }
+        }
+        /**
+         * @name 为一个范围预留槽
+         * @brief 前向迭代器可以先数出个数，单遍的输入迭代器不能
+         * @{
+         */
+        template<typename InputIt>
+        void reserveFor(InputIt first, InputIt last, std::forward_iterator_tag) {
+                reserve(static_cast<std::size_t>(std::distance(first, last)));
+        }
+        template<typename InputIt>
+        void reserveFor(InputIt, InputIt, std::input_iterator_tag) noexcept {}
+        /** @} */
+        /**
+         * @brief 在删除之前进行检查
+         *
+         * 链表为空时抛出异常
+         *
+         */
+        void checkNotEmpty() const {
+                if(empty()) {
+                        throw std::logic_error("cannot pop from empty list");
+                }
+        }
+public:
+        using allocator_type = Allocator; ///< 对接STL
+        /**
+         * @name 链表构造函数
+         * @{
+         */
+
+        /**
+         * @brief 无参构造函数
+         *
+         * 不分配内存，第一次插入时才分配slab
+         *
+         */
+        SlabLinkedList() noexcept(std::is_nothrow_default_constructible<SlotAllocator>::value):
+                _slots(nullptr), _capacity(0), _used(0), _head(NullIndex), _tail(NullIndex), _free(NullIndex), _length(0), _alloc() {}
+        /**
+         * @brief 指定分配器的构造函数
+         *
+         * @param alloc 要使用的分配器
+         */
+        explicit SlabLinkedList(const Allocator& alloc):
+                _slots(nullptr), _capacity(0), _used(0), _head(NullIndex), _tail(NullIndex), _free(NullIndex), _length(0), _alloc(alloc) {}
+        /**
+         * @brief 迭代器范围构造函数
+         *
+         * 前向迭代器先数出个数，一次分配好slab
+         *
+         * @param first 范围起点
+         * @param last 范围终点
+         * @param alloc 要使用的分配器
+         * @note 时间：O(n), 空间：O(n)
+         */
+        template<typename InputIt, typename = typename std::enable_if<!std::is_integral<InputIt>::value>::type>
+        SlabLinkedList(InputIt first, InputIt last, const Allocator& alloc = Allocator()):
+                SlabLinkedList(alloc) {
+                reserveFor(first, last, typename std::iterator_traits<InputIt>::iterator_category());
+                for(; first != last; ++first) {
+                        push_back(*first);
+                }
+        }
+        /**
+         * @brief 初始化列表构造函数
+         *
+         * @param init 初始元素
+         * @param alloc 要使用的分配器
+         * @note 时间：O(n), 空间：O(n)
+         */
+        SlabLinkedList(std::initializer_list<DataType> init, const Allocator& alloc = Allocator()):
+                SlabLinkedList(alloc) {
+                reserve(init.size());
+                for(const auto& data : init) {
+                        push_back(data);
+                }
+        }
+        /**
+         * @brief 拷贝构造函数
+         *
+         * DataType平凡可拷贝时一次memcpy整个slab，下标与other相同
+         * 否则逐个拷贝元素
+         *
+         * @param other 被拷贝的链表
+         * @note 时间：O(n), 空间：O(n)
+         */
+        SlabLinkedList(const SlabLinkedList& other):
+                SlabLinkedList(allocator_type(SlotAllocTraits::select_on_container_copy_construction(other._alloc))) {
+                copyFrom(other);
+        }
+        /**
+         * @brief 移动构造函数
+         *
+         * 接管other的slab，other随后为空
+         *
+         * @param other 被移动的链表
+         * @note 时间：O(1), 空间：O(1)
+         */
+        SlabLinkedList(SlabLinkedList&& other) noexcept:
+                _slots(nullptr), _capacity(0), _used(0), _head(NullIndex), _tail(NullIndex), _free(NullIndex), _length(0),
+                _alloc(std::move(other._alloc)) {
+                stealSlab(other);
+        }
+        /**
+         * @brief 拷贝赋值函数
+         *
+         * 先拷贝再移动过来，拷贝抛出异常时此链表不变
+         *
+         * @param other 被拷贝的链表
+         * @return 当前链表
+         * @note 时间：O(n), 空间：O(n)
+         */
+        SlabLinkedList& operator=(const SlabLinkedList& other) {
+                if(this != &other) {
+                        const bool propagate = SlotAllocTraits::propagate_on_container_copy_assignment::value;
+                        SlabLinkedList temp(allocator_type(propagate? other._alloc: _alloc));
+                        temp.copyFrom(other);
+                        release();
+                        if(propagate) {
+                                _alloc = other._alloc;
+                        }
+                        stealSlab(temp);
+                }
+                return *this;
+        }
+        /**
+         * @brief 移动赋值函数
+         *
+         * 释放此链表原有的slab，再接管other的slab
+         * 分配器不传播且两者不相等时无法接管，退化为逐个移动元素
+         *
+         * @param other 被移动的链表
+         * @return 当前链表
+         * @note 时间：O(n)，用于销毁原有元素；退化时 时间：O(n + other.size())
+         */
+        SlabLinkedList& operator=(SlabLinkedList&& other)
+                        noexcept(SlotAllocTraits::propagate_on_container_move_assignment::value) {
+                if(this == &other) {
+                        return *this;
+                }
+                if(SlotAllocTraits::propagate_on_container_move_assignment::value || _alloc == other._alloc) {
+                        release();
+                        if(SlotAllocTraits::propagate_on_container_move_assignment::value) {
+                                _alloc = std::move(other._alloc);
+                        }
+                        stealSlab(other);
+                        return *this;
+                }
+                clean();
+                reserve(static_cast<std::size_t>(other._length));
+                for(auto& data : other) {
+                        push_back(std::move(data));
+                }
+                other.release();
+                return *this;
+        }
+        /**
+         * @brief 初始化列表赋值
+         *
+         * @param init 新的元素
+         * @return 当前链表
+         * @note 时间：O(n), 空间：O(n)
+         */
+        SlabLinkedList& operator=(std::initializer_list<DataType> init) {
+                SlabLinkedList temp(init, get_allocator());
+                return *this = std::move(temp);
+        }
+        /** @} */
+        /**
+         * @brief 析构函数
+         *
+         * 销毁所有元素并释放slab
+         *
+         * @note 时间：O(n)；DataType平凡析构时 O(1), 空间：O(1)
+         */
+        ~SlabLinkedList() {
+                release();
+        }
+        /**
+         * @brief 获取分配器
+         *
+         * @return 由_alloc重绑定回DataType得到的分配器副本
+         */
+        allocator_type get_allocator() const {
+                return allocator_type(_alloc);
+        }
+
+        class ConstIterator;
+        /**
+         * @class Iterator
+         * @brief SlabLinkedList的内置迭代器
+         *
+         * 保存链表指针和槽的下标，slab扩容后仍然有效
+         * 指向被删除元素的迭代器失效
+         *
+         */
+        class Iterator {
+        private:
+                SlabLinkedList* _list; ///< 所属的链表
+                Index _curr; ///< 当前槽的下标，end()为NullIndex
+                friend class SlabLinkedList; ///< 使SlabLinkedList能访问Iterator私有成员
+                friend class ConstIterator; ///< 使ConstIterator能从Iterator构造
+        public:
+                /**
+                 * @brief 对接STL
+                 * @{
+                 */
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = DataType;
+                using difference_type = std::ptrdiff_t;
+                using pointer = DataType*;
+                using reference = DataType&;
+                /** @} */
+                explicit Iterator(SlabLinkedList* list = nullptr, Index index = NullIndex) noexcept: _list(list), _curr(index){}
+                DataType& operator*() const noexcept {
+                        return *_list -> dataAt(_curr);
+                }
+                DataType* operator->() const noexcept {
+                        return _list -> dataAt(_curr);
+                }
+                Iterator& operator++() noexcept {
+                        _curr = _list -> linkOf(_curr);
+                        return *this;
+                }
+                Iterator operator++(int) noexcept {
+                        auto temp = *this;
+                        _curr = _list -> linkOf(_curr);
+                        return temp;
+                }
+                bool operator==(const Iterator& other) const noexcept {
+                        return _curr == other._curr;
+                }
+                bool operator!=(const Iterator& other) const noexcept {
+                        return !(*this == other);
+                }
+        }; ///< class Iterator
+
+        /**
+         * @class ConstIterator
+         * @brief SlabLinkedList的内置Const迭代器
+         *
+         * @see Iterator
+         */
+        class ConstIterator {
+        private:
+                const SlabLinkedList* _list; ///< 所属的链表
+                Index _curr; ///< 当前槽的下标，end()为NullIndex
+                friend class SlabLinkedList; ///< 使SlabLinkedList能访问ConstIterator私有成员
+        public:
+                /**
+                 * @brief 对接STL
+                 * @{
+                 */
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = DataType;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const DataType*;
+                using reference = const DataType&;
+                /** @} */
+                explicit ConstIterator(const SlabLinkedList* list = nullptr, Index index = NullIndex) noexcept: _list(list), _curr(index){}
+                ConstIterator(const Iterator& it) noexcept: _list(it._list), _curr(it._curr){}
+                const DataType& operator*() const noexcept {
+                        return *_list -> dataAt(_curr);
+                }
+                const DataType* operator->() const noexcept {
+                        return _list -> dataAt(_curr);
+                }
+                ConstIterator& operator++() noexcept {
+                        _curr = _list -> linkOf(_curr);
+                        return *this;
+                }
+                ConstIterator operator++(int) noexcept {
+                        auto temp = *this;
+                        _curr = _list -> linkOf(_curr);
+                        return temp;
+                }
+                bool operator==(const ConstIterator& other) const noexcept {
+                        return _curr == other._curr;
+                }
+                bool operator!=(const ConstIterator& other) const noexcept {
+                        return !(*this == other);
+                }
+        }; ///< class ConstIterator
+
+        /**
+         * @name 迭代器
+         * @brief 与LinkedList相同，before_begin()只能递增或作为 *_after 系列函数的位置参数
+         * @{
+         */
+        Iterator before_begin() noexcept {
+                return Iterator(this, BeforeBegin);
+        }
+        ConstIterator before_begin() const noexcept {
+                return ConstIterator(this, BeforeBegin);
+        }
+        ConstIterator cbefore_begin() const noexcept {
+                return ConstIterator(this, BeforeBegin);
+        }
+        Iterator begin() noexcept {
+                return Iterator(this, _head);
+        }
+        ConstIterator begin() const noexcept {
+                return ConstIterator(this, _head);
+        }
+        ConstIterator cbegin() const noexcept {
+                return ConstIterator(this, _head);
+        }
+        Iterator end() noexcept {
+                return Iterator(this, NullIndex);
+        }
+        ConstIterator end() const noexcept {
+                return ConstIterator(this, NullIndex);
+        }
+        ConstIterator cend() const noexcept {
+                return ConstIterator(this, NullIndex);
+        }
+        /** @} */
+
+        /**
+         * @brief 获取链表长度
+         *
+         * @return _length成员
+         */
+        int size() const noexcept {
+                return _length;
+        }
+        /**
+         * @brief 判断链表是否为空
+         *
+         * @retval true 链表为空
+         * @retval false 反之
+         */
+        bool empty() const noexcept {
+                return _head == NullIndex;
+        }
+        /**
+         * @brief 获取slab的槽数
+         *
+         * @return 不扩容能容纳的元素个数
+         */
+        int capacity() const noexcept {
+                return static_cast<int>(_capacity);
+        }
+        /**
+         * @brief 预留至少n个槽
+         *
+         * 之后总数不超过n的插入都不再分配内存
+         * 槽数超过上限时抛出 std::length_error
+         *
+         * @param n 槽数
+         * @note 时间：需要扩容时O(已用过的槽数), 空间：O(n)
+         */
+        void reserve(std::size_t n) {
+                if(n > _capacity) {
+                        reallocate(grownCapacity(n));
+                }
+        }
+        /**
+         * @brief 清空链表
+         *
+         * 销毁所有元素，保留slab供之后的插入使用
+         * DataType平凡析构时不需要遍历
+         *
+         * @note 时间：O(n)；DataType平凡析构时 O(1), 空间：O(1)
+         */
+        void clean() noexcept {
+                if(!std::is_trivially_destructible<DataType>::value) {
+                        for(Index i = _head; i != NullIndex; i = _slots[i]._next) {
+                                dataAt(i) -> ~DataType();
+                        }
+                }
+                _used = 0;
+                _head = NullIndex;
+                _tail = NullIndex;
+                _free = NullIndex;
+                _length = 0;
+        }
+        /**
+         * @brief 按链表顺序重新排列slab
+         *
+         * 多次删除和插入之后，链表顺序与槽的顺序可能相差很远，空闲槽也留在中间
+         * 整理后第i个元素位于第i个槽，slab缩小到恰好容纳所有元素，遍历变成顺序访问
+         * 与LinkedList::compact()的作用相同
+         * 失败时链表不变，所有迭代器失效
+         *
+         * @note 时间：O(n), 空间：O(n)
+         */
+        void compact() {
+                if(_length == 0) {
+                        release();
+                        return;
+                }
+                const Index length = static_cast<Index>(_length);
+                Slot* fresh = SlotAllocTraits::allocate(_alloc, length);
+                Index moved = 0;
+                try {
+                        for(Index i = _head; i != NullIndex; i = _slots[i]._next, moved++) {
+                                ::new(static_cast<void*>(&fresh[moved]._storage)) DataType(std::move_if_noexcept(*dataAt(i)));
+                                fresh[moved]._next = moved + 1;
+                        }
+                } catch(...) {
+                        for(Index i = 0; i < moved; i++) {
+                                reinterpret_cast<DataType*>(&fresh[i]._storage) -> ~DataType();
+                        }
+                        SlotAllocTraits::deallocate(_alloc, fresh, length);
+                        throw;
+                }
+                fresh[length - 1]._next = NullIndex;
+                release();
+                _slots = fresh;
+                _capacity = length;
+                _used = length;
+                _head = 0;
+                _tail = length - 1;
+                _length = static_cast<int>(length);
+        }
+
+        /**
+         * @name 获取头元素
+         *
+         * 链表为空会抛出异常
+         *
+         * @return 头元素
+         * @note 时间：O(1), 空间：O(1)
+         * @{
+         */
+        DataType& front() {
+                if(empty()) {
+                        throw std::logic_error("SlabLinkedList is empty");
+                }
+                return *dataAt(_head);
+        }
+        const DataType& front() const {
+                if(empty()) {
+                        throw std::logic_error("SlabLinkedList is empty");
+                }
+                return *dataAt(_head);
+        }
+        /** @} */
+        /**
+         * @name 获取尾元素
+         *
+         * 链表为空会抛出异常
+         *
+         * @return 尾元素
+         * @note 时间：O(1), 空间：O(1)
+         * @{
+         */
+        DataType& back() {
+                if(empty()) {
+                        throw std::logic_error("SlabLinkedList is empty");
+                }
+                return *dataAt(_tail);
+        }
+        const DataType& back() const {
+                if(empty()) {
+                        throw std::logic_error("SlabLinkedList is empty");
+                }
+                return *dataAt(_tail);
+        }
+        /** @} */
+
+        /**
+         * @name 头插入
+         * @brief 将新元素作为头元素
+         *
+         * @param data 要插入的数据
+         * @note 时间：均摊O(1), 空间：O(1)
+         * @{
+         */
+        void push_front(const DataType& data) {
+                emplace_front(data);
+        }
+        void push_front(DataType&& data) {
+                emplace_front(std::move(data));
+        }
+        /** @} */
+        /**
+         * @name 尾插入
+         * @brief 将新元素作为尾元素
+         *
+         * @param data 要插入的数据
+         * @note 时间：均摊O(1), 空间：O(1)
+         * @{
+         */
+        void push_back(const DataType& data) {
+                emplace_back(data);
+        }
+        void push_back(DataType&& data) {
+                emplace_back(std::move(data));
+        }
+        /** @} */
+        /**
+         * @name 在指定位置之后插入
+         *
+         * @param pos 新元素插入在它的后面，可以是before_begin()
+         * @param data 要插入的数据
+         * @return 指向新元素的Iterator
+         * @note 时间：均摊O(1), 空间：O(1)
+         * @{
+         */
+        Iterator insert_after(ConstIterator pos, const DataType& data) {
+                return emplace_after(pos, data);
+        }
+        Iterator insert_after(ConstIterator pos, DataType&& data) {
+                return emplace_after(pos, std::move(data));
+        }
+        /** @} */
+        /**
+         * @name 原地构造
+         * @brief 用传入的参数直接在槽中构造新元素
+         *
+         * 构造抛出异常时链表不变
+         *
+         * @param args 转发给DataType构造函数的参数
+         * @note 时间：均摊O(1), 空间：O(1)
+         * @{
+         */
+
+        /**
+         * @brief 在头部构造
+         *
+         * @return 新元素的引用
+         */
+        template<typename... Args>
+        DataType& emplace_front(Args&&... args) {
+                const Index index = createNode(std::forward<Args>(args)...);
+                linkAfter(BeforeBegin, index);
+                return *dataAt(index);
+        }
+        /**
+         * @brief 在尾部构造
+         *
+         * @return 新元素的引用
+         */
+        template<typename... Args>
+        DataType& emplace_back(Args&&... args) {
+                const Index index = createNode(std::forward<Args>(args)...);
+                linkAfter(_tail == NullIndex? BeforeBegin: _tail, index);
+                return *dataAt(index);
+        }
+        /**
+         * @brief 在pos之后构造
+         *
+         * @param pos 新元素插入在它的后面，可以是before_begin()
+         * @return 指向新元素的Iterator
+         */
+        template<typename... Args>
+        Iterator emplace_after(ConstIterator pos, Args&&... args) {
+                const Index index = createNode(std::forward<Args>(args)...);
+                linkAfter(pos._curr, index);
+                return Iterator(this, index);
+        }
+        /** @} */
+
+        /**
+         * @brief 头删除
+         *
+         * 链表为空时抛出异常
+         *
+         * @note 时间：O(1), 空间：O(1)
+         */
+        void pop_front() {
+                checkNotEmpty();
+                destroyNode(unlinkAfter(BeforeBegin));
+        }
+        /**
+         * @name 删除指定位置之后的元素
+         *
+         * 被删除元素的槽进入空闲链表，指向它们的迭代器失效
+         *
+         * @{
+         */
+
+        /**
+         * @brief 单个元素版本
+         *
+         * pos之后必须有元素
+         *
+         * @param pos 被删除元素的前驱，可以是before_begin()
+         * @return 指向被删除元素之后的迭代器
+         * @note 时间：O(1), 空间：O(1)
+         */
+        Iterator erase_after(ConstIterator pos) noexcept {
+                destroyNode(unlinkAfter(pos._curr));
+                return Iterator(this, linkOf(pos._curr));
+        }
+        /**
+         * @brief 范围版本
+         *
+         * 删除(first, last)之间的元素，不含first和last
+         *
+         * @param first 被删除范围的前驱，可以是before_begin()
+         * @param last 被删除范围之后的位置
+         * @return last
+         * @note 时间：O(删除的元素数), 空间：O(1)
+         */
+        Iterator erase_after(ConstIterator first, ConstIterator last) noexcept {
+                while(linkOf(first._curr) != last._curr) {
+                        destroyNode(unlinkAfter(first._curr));
+                }
+                return Iterator(this, last._curr);
+        }
+        /** @} */
+
+        /**
+         * @name 查找
+         * @brief 寻找第一个等于data的元素
+         *
+         * @param data 要寻找的数据
+         * @return 找到的迭代器，未找到时为end()
+         * @note 时间：O(n), 空间：O(1)
+         * @{
+         */
+        Iterator find(const DataType& data) {
+                Index i = _head;
+                while(i != NullIndex && !(*dataAt(i) == data)) {
+                        i = _slots[i]._next;
+                }
+                return Iterator(this, i);
+        }
+        ConstIterator find(const DataType& data) const {
+                Index i = _head;
+                while(i != NullIndex && !(*dataAt(i) == data)) {
+                        i = _slots[i]._next;
+                }
+                return ConstIterator(this, i);
+        }
+        /** @} */
+        /**
+         * @brief 判断是否存在等于data的元素
+         *
+         * @param data 要寻找的数据
+         * @retval true 存在
+         * @retval false 不存在
+         * @note 时间：O(n), 空间：O(1)
+         */
+        bool contains(const DataType& data) const {
+                return find(data) != cend();
+        }
+}; ///< class SlabLinkedList
+/**
+ * @name 静态常量的定义
+ * @brief 以引用方式使用(例如作为条件运算符的操作数)时需要
+ * @{
+ */
+template<typename DataType, typename Allocator>
+const typename SlabLinkedList<DataType, Allocator>::Index SlabLinkedList<DataType, Allocator>::NullIndex;
+template<typename DataType, typename Allocator>
+const typename SlabLinkedList<DataType, Allocator>::Index SlabLinkedList<DataType, Allocator>::BeforeBegin;
+template<typename DataType, typename Allocator>
+const typename SlabLinkedList<DataType, Allocator>::Index SlabLinkedList<DataType, Allocator>::MaxCapacity;
+template<typename DataType, typename Allocator>
+const typename SlabLinkedList<DataType, Allocator>::Index SlabLinkedList<DataType, Allocator>::InitialCapacity;
+/** @} */
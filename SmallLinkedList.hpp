@@ -0,0 +1,391 @@
+#pragma once
+/**
+ * @file SmallLinkedList.hpp
+ * @class SmallLinkedList
+ * @brief 前K个节点存放在链表对象内部的链表
+ *
+ * 链表对象内嵌一块能放K个节点的缓冲区(InlineNodeArena)
+ * 节点优先从缓冲区中分配，缓冲区用完后才向堆申请
+ * 元素个数不超过K的短链表完全不访问堆，节点也都挨在一起
+ *
+ * 用法：
+ * @code
+ * SmallLinkedList<int, 8> l = {1, 2, 3};
+ * l.push_back(4); // 不分配堆内存
+ * @endcode
+ *
+ * @note 节点位于链表对象内部，移动时无法直接接管，移动构造和移动赋值都是逐个移动元素，时间为O(n)
+ * @note 两个SmallLinkedList的分配器总是不相等，它们之间的splice_after() append() merge()也是逐个移动元素
+ * @note get_allocator() 得到的分配器指向这个链表的缓冲区，不能在链表销毁后继续使用
+ *
+ * @author neOzkyol
+ * @date 2026-01-19
+ * @version 1.0
+ */
+#include <cstddef> ///< std::size_t
+#include <functional> ///< std::less
+#include <initializer_list> ///< std::initializer_list
+#include <memory> ///< std::allocator std::allocator_traits
+#include <type_traits> ///< std::false_type std::aligned_storage std::enable_if
+#include <utility> ///< std::move
+#include "LinkedList.hpp" ///< LinkedList
+/**
+ * @class InlineNodeArena
+ * @brief 固定个数、固定大小的内存槽
+ *
+ * InlineAllocator的实现细节
+ * 先按顺序切出未用过的槽，归还的槽挂到空闲链表上，下次优先复用
+ * 不可拷贝，也不可移动，分配出去的地址在它的整个生命期内有效
+ *
+ * @tparam SlotSize 每个槽的大小
+ * @tparam SlotAlign 每个槽的对齐
+ * @tparam Count 槽的个数
+ */
+template<std::size_t SlotSize, std::size_t SlotAlign, std::size_t Count>
+class InlineNodeArena {
+private:
+        union Slot { ///< 一个槽，空闲时复用槽本身的内存做链表
+                Slot* _next; ///< 下一个空闲槽
+                typename std::aligned_storage<SlotSize, SlotAlign>::type _storage; ///< 节点的内存
+        };
+        Slot _slots[Count]; ///< 所有槽
+        Slot* _freeList; ///< 空闲链表
+        std::size_t _used; ///< 按顺序切出过的槽数
+        static_assert(Count > 0, "InlineNodeArena needs at least one slot");
+public:
+        static const std::size_t slot_size = SlotSize; ///< 能存放的最大对象大小
+        static const std::size_t slot_align = SlotAlign; ///< 能满足的最大对齐
+        InlineNodeArena() noexcept: _freeList(nullptr), _used(0) {}
+        InlineNodeArena(const InlineNodeArena&) = delete;
+        InlineNodeArena& operator=(const InlineNodeArena&) = delete;
+        /**
+         * @brief 取出一个槽
+         *
+         * @return 槽的地址，槽已用完时为 nullptr
+         * @note 时间：O(1), 空间：O(1)
+         */
+        void* allocate() noexcept {
+                if(_freeList != nullptr) {
+                        Slot* slot = _freeList;
+                        _freeList = slot -> _next;
+                        return slot;
+                }
+                if(_used < Count) {
+                        return &_slots[_used++];
+                }
+                return nullptr;
+        }
+        /**
+         * @brief 归还一个槽
+         *
+         * @param p allocate()得到的地址
+         * @note 时间：O(1), 空间：O(1)
+         */
+        void deallocate(void* p) noexcept {
+                Slot* slot = static_cast<Slot*>(p);
+                slot -> _next = _freeList;
+                _freeList = slot;
+        }
+        /**
+         * @brief 判断地址是否属于这些槽
+         *
+         * 使用 std::less 比较，与任意来源的指针比较都有定义
+         *
+         * @param p 要判断的地址
+         * @retval true p是某个槽的地址
+         * @retval false p来自别处
+         * @note 时间：O(1), 空间：O(1)
+         */
+        bool owns(const void* p) const noexcept {
+                std::less<const void*> less;
+                return !less(p, static_cast<const void*>(_slots)) && less(p, static_cast<const void*>(_slots + Count));
+        }
+}; ///< class InlineNodeArena
+
+/**
+ * @class InlineAllocator
+ * @brief 先从InlineNodeArena分配、用完后交给另一个分配器的分配器
+ *
+ * 只有单个对象且大小、对齐都放得进槽时才使用槽，其余请求直接交给Fallback
+ * 指向同一个InlineNodeArena(且Fallback相等)时相等
+ * 不传播：容器之间拷贝、移动、交换时都保留自己的分配器，
+ * 所以不同缓冲区的链表之间移动时会逐个移动元素
+ *
+ * @tparam T 分配的类型
+ * @tparam Arena InlineNodeArena的一个实例化
+ * @tparam Fallback 槽用完后使用的分配器
+ */
+template<typename T, typename Arena, typename Fallback = std::allocator<T>>
+class InlineAllocator {
+private:
+        template<typename U, typename A, typename F>
+        friend class InlineAllocator; ///< 使不同类型的InlineAllocator能互相访问
+        using FallbackTraits = std::allocator_traits<Fallback>;
+        Arena* _arena; ///< 优先使用的槽，为 nullptr 时全部交给_fallback
+        Fallback _fallback; ///< 槽用完后使用的分配器
+        static const bool fitsSlot = sizeof(T) <= Arena::slot_size && alignof(T) <= Arena::slot_align; ///< T能否放进一个槽
+public:
+        /**
+         * @brief 对接STL
+         * @{
+         */
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using propagate_on_container_copy_assignment = std::false_type;
+        using propagate_on_container_move_assignment = std::false_type;
+        using propagate_on_container_swap = std::false_type;
+        template<typename U>
+        struct rebind {
+                using other = InlineAllocator<U, Arena, typename FallbackTraits::template rebind_alloc<U>>;
+        };
+        /** @} */
+
+        /**
+         * @brief 无参构造函数
+         *
+         * 不使用任何槽，所有请求交给Fallback
+         *
+         */
+        InlineAllocator() noexcept(std::is_nothrow_default_constructible<Fallback>::value): _arena(nullptr), _fallback() {}
+        /**
+         * @brief 构造函数
+         *
+         * @param arena 优先使用的槽，调用者保证它比所有从中分配的对象活得更久
+         * @param fallback 槽用完后使用的分配器
+         */
+        explicit InlineAllocator(Arena* arena, const Fallback& fallback = Fallback()): _arena(arena), _fallback(fallback) {}
+        /**
+         * @brief 重绑定构造函数
+         *
+         * 与other使用同一组槽
+         *
+         * @param other 被重绑定的分配器
+         */
+        template<typename U, typename F>
+        InlineAllocator(const InlineAllocator<U, Arena, F>& other): _arena(other._arena), _fallback(other._fallback) {}
+        /**
+         * @brief 容器拷贝时使用的分配器
+         *
+         * 槽属于原容器，副本只使用Fallback
+         * SmallLinkedList的拷贝构造会另外指定自己的槽
+         *
+         * @return 不使用槽的分配器
+         */
+        InlineAllocator select_on_container_copy_construction() const {
+                return InlineAllocator(nullptr, FallbackTraits::select_on_container_copy_construction(_fallback));
+        }
+        /**
+         * @brief 分配n个T的内存
+         *
+         * @param n 个数
+         * @return 内存的首地址
+         * @note 时间：O(1)；交给Fallback时取决于Fallback
+         */
+        T* allocate(std::size_t n) {
+                if(fitsSlot && n == 1 && _arena != nullptr) {
+                        void* slot = _arena -> allocate();
+                        if(slot != nullptr) {
+                                return static_cast<T*>(slot);
+                        }
+                }
+                return FallbackTraits::allocate(_fallback, n);
+        }
+        /**
+         * @brief 归还n个T的内存
+         *
+         * 根据地址判断来自槽还是Fallback
+         *
+         * @param p allocate()得到的地址
+         * @param n allocate()时的个数
+         * @note 时间：O(1)；交给Fallback时取决于Fallback
+         */
+        void deallocate(T* p, std::size_t n) noexcept {
+                if(_arena != nullptr && _arena -> owns(p)) {
+                        _arena -> deallocate(p);
+                        return;
+                }
+                FallbackTraits::deallocate(_fallback, p, n);
+        }
+        /**
+         * @brief ==比较重载
+         *
+         * 使用同一组槽且Fallback相等时相等，此时可以互相释放对方分配的内存
+         *
+         */
+        template<typename U, typename F>
+        bool operator==(const InlineAllocator<U, Arena, F>& other) const noexcept {
+                return _arena == other._arena && _fallback == other._fallback;
+        }
+        template<typename U, typename F>
+        bool operator!=(const InlineAllocator<U, Arena, F>& other) const noexcept {
+                return !(*this == other);
+        }
+}; ///< class InlineAllocator
+
+/**
+ * @class InlineArenaHolder
+ * @brief SmallLinkedList的实现细节
+ *
+ * 作为SmallLinkedList的第一个基类，保证缓冲区先于LinkedList构造、晚于LinkedList析构
+ *
+ */
+template<typename Arena>
+struct InlineArenaHolder {
+        Arena _inlineArena; ///< 节点缓冲区
+};
+
+/**
+ * @brief SmallLinkedList节点的布局
+ *
+ * 与 LinkedList::Node 相同：一个指针后跟数据
+ * 用来确定槽的大小和对齐，放不下时InlineAllocator会全部交给Fallback
+ *
+ */
+template<typename DataType>
+struct SmallListNodeLayout {
+        void* _next; ///< 对应 NodeBase::_next
+        DataType _data; ///< 对应 Node::_data
+};
+
+/**
+ * @tparam DataType 链表存储的数据类型
+ * @tparam InlineCount 存放在链表对象内部的节点个数
+ * @tparam Fallback 内部缓冲区用完后使用的分配器，默认为 std::allocator
+ */
+template<typename DataType, std::size_t InlineCount = 8, typename Fallback = std::allocator<DataType>>
+class SmallLinkedList:
+        private InlineArenaHolder<InlineNodeArena<sizeof(SmallListNodeLayout<DataType>), alignof(SmallListNodeLayout<DataType>), InlineCount>>,
+        public LinkedList<DataType, InlineAllocator<DataType,
+                InlineNodeArena<sizeof(SmallListNodeLayout<DataType>), alignof(SmallListNodeLayout<DataType>), InlineCount>, Fallback>> {
+public:
+        using arena_type = InlineNodeArena<sizeof(SmallListNodeLayout<DataType>), alignof(SmallListNodeLayout<DataType>), InlineCount>; ///< 内部缓冲区的类型
+        using allocator_type = InlineAllocator<DataType, arena_type, Fallback>; ///< 对接STL
+private:
+        using Holder = InlineArenaHolder<arena_type>;
+        using Base = LinkedList<DataType, allocator_type>;
+        /**
+         * @brief 指向缓冲区的分配器
+         *
+         * 构造函数在LinkedList基类构造之前调用，所以是静态函数
+         *
+         * @param holder 此链表的缓冲区所在的基类
+         * @param fallback 缓冲区用完后使用的分配器
+         * @return 分配器
+         */
+        static allocator_type inlineAllocator(Holder& holder, const Fallback& fallback = Fallback()) {
+                return allocator_type(&holder._inlineArena, fallback);
+        }
+public:
+        /**
+         * @name 链表构造函数
+         * @brief 对链表进行初始化，节点都优先放进自己的缓冲区
+         * @{
+         */
+
+        /**
+         * @brief 无参构造函数
+         *
+         * @note 时间：O(1), 空间：O(1)
+         */
+        SmallLinkedList(): Holder(), Base(inlineAllocator(*this)) {}
+        /**
+         * @brief 指定Fallback的构造函数
+         *
+         * @param fallback 缓冲区用完后使用的分配器
+         * @note 时间：O(1), 空间：O(1)
+         */
+        explicit SmallLinkedList(const Fallback& fallback): Holder(), Base(inlineAllocator(*this, fallback)) {}
+        /**
+         * @brief 迭代器范围构造函数
+         *
+         * @param first 范围起点
+         * @param last 范围终点
+         * @note 时间：O(n), 空间：O(n)
+         */
+        template<typename InputIt, typename = typename std::enable_if<!std::is_integral<InputIt>::value>::type>
+        SmallLinkedList(InputIt first, InputIt last): Holder(), Base(inlineAllocator(*this)) {
+                Base::assign(first, last);
+        }
+        /**
+         * @brief 初始化列表构造函数
+         *
+         * @param init 初始元素
+         * @note 时间：O(n), 空间：O(n)
+         */
+        SmallLinkedList(std::initializer_list<DataType> init): Holder(), Base(init, inlineAllocator(*this)) {}
+        /**
+         * @brief 拷贝构造函数
+         *
+         * 新链表的节点放进自己的缓冲区，不与other共享
+         *
+         * @param other 被拷贝的链表
+         * @note 时间：O(n), 空间：O(n)
+         */
+        SmallLinkedList(const SmallLinkedList& other): Holder(), Base(inlineAllocator(*this)) {
+                Base::assign(other.cbegin(), other.cend());
+        }
+        /**
+         * @brief 移动构造函数
+         *
+         * other的节点可能在other的缓冲区中，不能直接接管
+         * 逐个把元素移动到新节点中，other随后清空
+         *
+         * @param other 被移动的链表
+         * @note 时间：O(n), 空间：O(n)
+         */
+        SmallLinkedList(SmallLinkedList&& other): Holder(), Base(std::move(other), inlineAllocator(*this)) {}
+        /**
+         * @brief 拷贝赋值
+         *
+         * 先清空再拷贝，旧节点腾出的槽可以直接给新节点使用
+         * 拷贝中途抛出异常时链表为空(基本异常保证)
+         *
+         * @param other 被拷贝的链表
+         * @return 当前链表
+         * @note 时间：O(n), 空间：O(n)
+         */
+        SmallLinkedList& operator=(const SmallLinkedList& other) {
+                if(this == &other) {
+                        return *this;
+                }
+                Base::clean();
+                Base::assign(other.cbegin(), other.cend());
+                return *this;
+        }
+        /**
+         * @brief 移动赋值
+         *
+         * 与移动构造相同，逐个移动元素
+         *
+         * @param other 被移动的链表
+         * @return 当前链表
+         * @note 时间：O(n), 空间：O(n)
+         */
+        SmallLinkedList& operator=(SmallLinkedList&& other) {
+                Base::operator=(std::move(other));
+                return *this;
+        }
+        /**
+         * @brief 初始化列表赋值
+         *
+         * @param init 新的元素
+         * @return 当前链表
+         * @note 时间：O(n), 空间：O(n)
+         */
+        SmallLinkedList& operator=(std::initializer_list<DataType> init) {
+                Base::clean();
+                Base::assign(init);
+                return *this;
+        }
+        /** @} */
+
+        /**
+         * @brief 内部缓冲区能存放的节点个数
+         *
+         * @return InlineCount
+         */
+        static constexpr std::size_t inline_capacity() noexcept {
+                return InlineCount;
+        }
+}; ///< class SmallLinkedList
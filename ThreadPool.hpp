@@ -0,0 +1,166 @@
+#pragma once
+/**
+ * @file ThreadPool.hpp
+ * @class ThreadPool
+ * @brief 一个固定线程数的线程池
+ *
+ * ParallelAlgorithms.hpp 中的并行算法把链表分块后交给它执行
+ * LinkedList::parallel_sort() 和 clear_async() 也使用它
+ * 任务按提交顺序从一个共享队列中取出
+ *
+ * 用法：
+ * @code
+ * ThreadPool pool(8);
+ * auto f = pool.submit([] { return 42; });
+ * f.get();
+ * @endcode
+ *
+ * @note 不要在池中的任务里等待同一个池的其他任务，线程都在等待时会死锁
+ *
+ * @author neOzkyol
+ * @date 2026-01-18
+ * @version 1.0
+ */
+#include <condition_variable> ///< std::condition_variable
+#include <cstddef> ///< std::size_t
+#include <deque> ///< std::deque
+#include <functional> ///< std::function
+#include <future> ///< std::future std::packaged_task
+#include <memory> ///< std::make_shared
+#include <mutex> ///< std::mutex std::unique_lock
+#include <thread> ///< std::thread
+#include <utility> ///< std::move std::forward
+#include <vector> ///< std::vector
+class ThreadPool {
+private:
+        std::vector<std::thread> _workers; ///< 工作线程
+        std::deque<std::function<void()>> _tasks; ///< 等待执行的任务
+        std::mutex _mutex; ///< 保护_tasks和_stopping
+        std::condition_variable _ready; ///< 有新任务或要停止时通知
+        bool _stopping; ///< 析构开始后为true
+        /**
+         * @brief 工作线程的主循环
+         *
+         * 取出任务并执行，队列为空且要停止时退出
+         * 任务的异常由packaged_task保存到future中，不会逃出这里
+         *
+         */
+        void workerLoop() {
+                for(;;) {
+                        std::function<void()> task;
+                        {
+                                std::unique_lock<std::mutex> lock(_mutex);
+                                _ready.wait(lock, [this] { return _stopping || !_tasks.empty(); });
+                                if(_tasks.empty()) {
+                                        return;
+                                }
+                                task = std::move(_tasks.front());
+                                _tasks.pop_front();
+                        }
+                        task();
+                }
+        }
+        /**
+         * @brief 通知所有线程停止并等待它们退出
+         *
+         */
+        void stop() noexcept {
+                {
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        _stopping = true;
+                }
+                _ready.notify_all();
+                for(auto& worker : _workers) {
+                        if(worker.joinable()) {
+                                worker.join();
+                        }
+                }
+        }
+public:
+        /**
+         * @brief 构造函数
+         *
+         * 立即启动线程
+         * 创建线程失败时停止已启动的线程，再抛出异常
+         *
+         * @param threads 线程数，为0时使用 std::thread::hardware_concurrency()，至少为1
+         */
+        explicit ThreadPool(std::size_t threads = 0): _stopping(false) {
+                if(threads == 0) {
+                        threads = std::thread::hardware_concurrency();
+                }
+                if(threads == 0) {
+                        threads = 1;
+                }
+                _workers.reserve(threads);
+                try {
+                        for(std::size_t i = 0; i < threads; i++) {
+                                _workers.emplace_back([this] { workerLoop(); });
+                        }
+                } catch(...) {
+                        stop();
+                        throw;
+                }
+        }
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+        /**
+         * @brief 析构函数
+         *
+         * 执行完队列中剩余的任务后等待所有线程退出
+         *
+         */
+        ~ThreadPool() {
+                stop();
+        }
+        /**
+         * @brief 进程共享的线程池
+         *
+         * 第一次使用时创建，线程数为 hardware_concurrency()
+         * 不接受线程池参数的并行算法使用它
+         *
+         * @return 线程池的引用
+         */
+        static ThreadPool& shared() {
+                static ThreadPool pool;
+                return pool;
+        }
+        /**
+         * @brief 进程共享的单线程后台池
+         *
+         * 用于把不急的工作(如 LinkedList::clear_async() 的释放)移出调用线程
+         * 程序退出时执行完剩余任务
+         *
+         * @return 线程池的引用
+         */
+        static ThreadPool& background() {
+                static ThreadPool pool(1);
+                return pool;
+        }
+        /**
+         * @brief 获取线程数
+         *
+         * @return 工作线程的个数
+         */
+        std::size_t size() const noexcept {
+                return _workers.size();
+        }
+        /**
+         * @brief 提交一个任务
+         *
+         * @param f 无参可调用对象
+         * @return 任务结果的future，任务抛出的异常在get()时重新抛出
+         */
+        template<typename Function>
+        auto submit(Function&& f) -> std::future<decltype(f())> {
+                using Result = decltype(f());
+                auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Function>(f));
+                std::future<Result> result = task -> get_future();
+                {
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        _tasks.emplace_back([task] { (*task)(); });
+                }
+                _ready.notify_one();
+                return result;
+        }
+}; ///< class ThreadPool
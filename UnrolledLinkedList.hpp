@@ -0,0 +1,999 @@
+#pragma once
+/**
+ * @file UnrolledLinkedList.hpp
+ * @class UnrolledLinkedList
+ * @brief 一个基于模板的展开单向链表类
+ *
+ * 每个节点(Block)存放最多N个连续的元素，而不是一个
+ * 遍历、查找时每次缓存未命中能处理多个元素，指针开销也摊到N个元素上
+ * 适合元素较小、以扫描为主的场景
+ *
+ * 公开接口是LinkedList的一个子集：
+ * 构造、赋值、迭代器、operator[]、find() find_index() count() contains()、front() back()、
+ * push_*() emplace_*() insert() pop_*() erase() remove_if() append()、size() empty() clean()
+ * 不提供before_begin()和 *_after 系列(insert_after() emplace_after() erase_after() splice_after())：
+ * 迭代器是(节点, 节点内位置)，在节点中间插入或删除要移动同一节点中的其他元素，还可能分裂、合并节点，
+ * 做不到LinkedList那样O(1)且不使其他迭代器失效
+ * 也不提供sort()和merge()：LinkedList的版本只改指针、不移动元素，这里的元素存放在节点的数组中，无法做到
+ * 需要排序时可以先拷贝到std::vector中
+ *
+ * @author neOzkyol
+ * @date 2026-01-17
+ * @version 1.0
+ */
+#include <iterator> ///< std::forward_iterator_tag
+#include <cstddef> ///< std::ptrdiff_t
+#include <stdexcept> ///< std::out_of_range std::logic_error
+#include <memory> ///< std::allocator std::allocator_traits
+#include <utility> ///< std::move std::forward
+#include <algorithm> ///< std::move_backward
+#include <new> ///< placement new
+#include <type_traits> ///< std::true_type std::false_type
+#include "SimdSearch.hpp" ///< SimdSearch
+/**
+ * @tparam DataType 链表存储的数据类型
+ * @tparam N 每个节点最多存放的元素个数，至少为2
+ * @tparam Allocator 分配器，内部会通过 std::allocator_traits 重绑定到 Block
+ */
+template<typename DataType, int N = 16, typename Allocator = std::allocator<DataType>>
+class UnrolledLinkedList {
+        static_assert(N >= 2, "UnrolledLinkedList needs at least 2 elements per block");
+private:
+        /**
+         * @brief 链表节点
+         *
+         * 前_count个位置存有元素，其余位置是未构造的内存
+         *
+         */
+        struct Block {
+                Block* _next; ///< 指向下一个节点的指针
+                int _count; ///< 此节点中的元素个数
+                typename std::aligned_storage<sizeof(DataType), alignof(DataType)>::type _storage[N]; ///< 元素的存储空间
+                Block() noexcept: _next(nullptr), _count(0){}
+                /**
+                 * @brief 获取元素数组
+                 *
+                 * @return 指向第一个元素的指针
+                 */
+                DataType* data() noexcept {
+                        return reinterpret_cast<DataType*>(_storage);
+                }
+                const DataType* data() const noexcept {
+                        return reinterpret_cast<const DataType*>(_storage);
+                }
+        };
+        /**
+         * @brief 重绑定到Block的分配器类型
+         * @{
+         */
+        using BlockAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Block>;
+        using BlockAllocTraits = std::allocator_traits<BlockAllocator>;
+        /** @} */
+        Block* _head; ///< 链表头结点，是数据节点
+        Block* _tail; ///< 链表尾结点，链表为空时为 nullptr
+        int _length; ///< 链表中元素的总数
+        BlockAllocator _alloc; ///< 所有节点都通过它分配和释放
+        /**
+         * @brief 创建一个空节点
+         *
+         * @return 新节点的指针
+         * @note 时间：O(1), 空间：O(1)
+         */
+        Block* createBlock() {
+                Block* block = BlockAllocTraits::allocate(_alloc, 1);
+                BlockAllocTraits::construct(_alloc, block);
+                return block;
+        }
+        /**
+         * @brief 销毁一个节点
+         *
+         * 先析构其中的元素，再释放节点
+         *
+         * @param block 要销毁的节点
+         * @note 时间：O(N), 空间：O(1)
+         */
+        void destroyBlock(Block* block) noexcept {
+                DataType* d = block -> data();
+                for(int i = 0; i < block -> _count; i++) {
+                        d[i].~DataType();
+                }
+                BlockAllocTraits::destroy(_alloc, block);
+                BlockAllocTraits::deallocate(_alloc, block, 1);
+        }
+        /**
+         * @brief 在block之后接入一个新的空节点
+         *
+         * @param block 新节点接在它的后面，为 nullptr 时接在头部
+         * @return 新节点的指针
+         */
+        Block* insertBlockAfter(Block* block) {
+                Block* newBlock = createBlock();
+                if(block == nullptr) {
+                        newBlock -> _next = _head;
+                        _head = newBlock;
+                } else {
+                        newBlock -> _next = block -> _next;
+                        block -> _next = newBlock;
+                }
+                if(newBlock -> _next == nullptr) {
+                        _tail = newBlock;
+                }
+                return newBlock;
+        }
+        /**
+         * @brief 摘下并销毁prev之后的空节点
+         *
+         * @param prev 前一个节点，为 nullptr 时表示block是头结点
+         * @param block 要删除的空节点
+         */
+        void unlinkBlock(Block* prev, Block* block) noexcept {
+                (prev == nullptr? _head: prev -> _next) = block -> _next;
+                if(_tail == block) {
+                        _tail = prev;
+                }
+                destroyBlock(block);
+        }
+        /**
+         * @brief 只保留节点的前kept个元素
+         *
+         * 析构其余元素，节点变空时将其删除
+         *
+         * @param prev block的前一个节点，头结点时为 nullptr
+         * @param block 目标节点
+         * @param kept 保留的元素个数
+         * @return 节点是否被删除
+         */
+        bool shrinkBlock(Block* prev, Block* block, int kept) noexcept {
+                DataType* d = block -> data();
+                for(int i = kept; i < block -> _count; i++) {
+                        d[i].~DataType();
+                }
+                _length -= block -> _count - kept;
+                block -> _count = kept;
+                if(kept == 0) {
+                        unlinkBlock(prev, block);
+                        return true;
+                }
+                return false;
+        }
+        /**
+         * @brief 寻找index所在的节点
+         *
+         * @param index 元素索引，传入时为全局索引，返回时为节点内的索引
+         * @param prev 返回找到的节点的前一个节点，头结点时为 nullptr
+         * @return 找到的节点
+         * @note 时间：O(n / N), 空间：O(1)
+         */
+        Block* locate(int& index, Block*& prev) const noexcept {
+                prev = nullptr;
+                Block* curr = _head;
+                while(index >= curr -> _count) {
+                        index -= curr -> _count;
+                        prev = curr;
+                        curr = curr -> _next;
+                }
+                return curr;
+        }
+        /**
+         * @brief 把满节点的后一半移动到新节点中
+         *
+         * @param block 已满的节点
+         * @return 新节点，接在block之后
+         * @note 时间：O(N), 空间：O(1)
+         */
+        Block* split(Block* block) {
+                Block* newBlock = insertBlockAfter(block);
+                const int keep = N / 2;
+                DataType* from = block -> data();
+                DataType* to = newBlock -> data();
+                for(int i = keep; i < block -> _count; i++) {
+                        ::new(static_cast<void*>(to + newBlock -> _count)) DataType(std::move(from[i]));
+                        newBlock -> _count++;
+                }
+                for(int i = keep; i < block -> _count; i++) {
+                        from[i].~DataType();
+                }
+                block -> _count = keep;
+                return newBlock;
+        }
+        /**
+         * @brief 在节点内的pos位置构造新元素
+         *
+         * 之后的元素依次后移一位，调用前节点必须未满
+         *
+         * @param block 目标节点
+         * @param pos 节点内的位置
+         * @param args 转发给DataType构造函数的参数
+         * @return 新元素的引用
+         * @note 时间：O(N), 空间：O(1)
+         */
+        template<typename... Args>
+        DataType& emplaceInBlock(Block* block, int pos, Args&&... args) {
+                DataType* d = block -> data();
+                const int count = block -> _count;
+                if(pos == count) {
+                        ::new(static_cast<void*>(d + count)) DataType(std::forward<Args>(args)...);
+                } else {
+                        DataType temp(std::forward<Args>(args)...);
+                        ::new(static_cast<void*>(d + count)) DataType(std::move(d[count - 1]));
+                        std::move_backward(d + pos, d + count - 1, d + count);
+                        d[pos] = std::move(temp);
+                }
+                block -> _count++;
+                _length++;
+                return d[pos];
+        }
+        /**
+         * @brief 删除节点内pos位置的元素
+         *
+         * 之后的元素依次前移一位
+         * 节点不足半满时，从下一个节点借元素或与其合并
+         * 节点变空时将其删除
+         *
+         * @param prev block的前一个节点，头结点时为 nullptr
+         * @param block 目标节点
+         * @param pos 节点内的位置
+         * @note 时间：O(N), 空间：O(1)
+         */
+        void eraseInBlock(Block* prev, Block* block, int pos) {
+                DataType* d = block -> data();
+                std::move(d + pos + 1, d + block -> _count, d + pos);
+                d[block -> _count - 1].~DataType();
+                block -> _count--;
+                _length--;
+                if(block -> _count == 0) {
+                        unlinkBlock(prev, block);
+                        return;
+                }
+                Block* next = block -> _next;
+                if(block -> _count >= N / 2 || next == nullptr) {
+                        return;
+                }
+                const int moveCount = block -> _count + next -> _count <= N?
+                        next -> _count: (next -> _count - block -> _count + 1) / 2;
+                DataType* nd = next -> data();
+                for(int i = 0; i < moveCount; i++) {
+                        ::new(static_cast<void*>(d + block -> _count)) DataType(std::move(nd[i]));
+                        block -> _count++;
+                }
+                std::move(nd + moveCount, nd + next -> _count, nd);
+                for(int i = next -> _count - moveCount; i < next -> _count; i++) {
+                        nd[i].~DataType();
+                }
+                next -> _count -= moveCount;
+                if(next -> _count == 0) {
+                        unlinkBlock(block, next);
+                }
+        }
+        /**
+         * @brief 在指定位置构造新元素
+         *
+         * insert()的实现，目标节点已满时先分裂
+         *
+         * @param index 插入后新元素的索引
+         * @param args 转发给DataType构造函数的参数
+         * @note 时间：O(n / N + N), 空间：O(1)
+         */
+        template<typename... Args>
+        void emplaceAt(int index, Args&&... args) {
+                if(index < 0 || index > _length) {
+                        throw std::out_of_range("index out of range");
+                } else if(index == _length) {
+                        emplace_back(std::forward<Args>(args)...);
+                        return;
+                }
+                Block* prev;
+                Block* block = locate(index, prev);
+                if(block -> _count == N) {
+                        Block* upper = split(block);
+                        if(index > block -> _count) {
+                                index -= block -> _count;
+                                block = upper;
+                        }
+                }
+                emplaceInBlock(block, index, std::forward<Args>(args)...);
+        }
+        /**
+         * @brief 接管另一个链表的全部节点
+         *
+         * 调用前此链表必须为空
+         *
+         * @param other 被接管的链表，之后置空
+         */
+        void stealBlocks(UnrolledLinkedList& other) noexcept {
+                _head = other._head;
+                _tail = other._tail;
+                _length = other._length;
+                other._head = nullptr;
+                other._tail = nullptr;
+                other._length = 0;
+        }
+        /**
+         * @brief 逐个拷贝other中的元素
+         *
+         * 每个节点都按other中的节点装满，保持同样的紧凑程度
+         *
+         * @param other 被拷贝的链表
+         * @note 时间：O(n), 空间：O(1)
+         */
+        void copyFrom(const UnrolledLinkedList& other) {
+                for(Block* curr = other._head; curr != nullptr; curr = curr -> _next) {
+                        Block* block = insertBlockAfter(_tail);
+                        for(int i = 0; i < curr -> _count; i++) {
+                                ::new(static_cast<void*>(block -> data() + i)) DataType(curr -> data()[i]);
+                                block -> _count++;
+                                _length++;
+                        }
+                }
+        }
+        void copyAllocatorFrom(const UnrolledLinkedList& other, std::true_type) {
+                _alloc = other._alloc;
+        }
+        void copyAllocatorFrom(const UnrolledLinkedList&, std::false_type) noexcept {}
+        void moveAllocatorFrom(UnrolledLinkedList& other, std::true_type) noexcept {
+                _alloc = std::move(other._alloc);
+        }
+        void moveAllocatorFrom(UnrolledLinkedList&, std::false_type) noexcept {}
+        /**
+         * @brief 逐个把other的元素移动到尾部
+         *
+         * append()在两者分配器不相等时的实现
+         * 抛出异常时已移动的元素留在此链表中，other仍会清空
+         *
+         * @param other 被拼接的链表，随后为空
+         * @note 时间：O(m), 空间：O(1)
+         */
+        void appendByMove(UnrolledLinkedList& other) {
+                try {
+                        for(auto& data : other) {
+                                push_back(std::move(data));
+                        }
+                } catch(...) {
+                        other.clean();
+                        throw;
+                }
+                other.clean();
+        }
+public:
+        using allocator_type = Allocator; ///< 对接STL
+        /**
+         * @name 链表构造函数
+         * @brief 对链表进行初始化
+         * @{
+         */
+        UnrolledLinkedList() noexcept(std::is_nothrow_default_constructible<BlockAllocator>::value):
+                _head(nullptr), _tail(nullptr), _length(0), _alloc() {}
+        explicit UnrolledLinkedList(const Allocator& alloc):
+                _head(nullptr), _tail(nullptr), _length(0), _alloc(alloc) {}
+        /**
+         * @brief 拷贝构造函数
+         *
+         * @param other 拷贝给此链表的链表
+         * @note 时间：O(n), 空间：O(1)
+         */
+        UnrolledLinkedList(const UnrolledLinkedList& other):
+                _head(nullptr), _tail(nullptr), _length(0),
+                _alloc(BlockAllocTraits::select_on_container_copy_construction(other._alloc)) {
+                try {
+                        copyFrom(other);
+                } catch(...) {
+                        clean();
+                        throw;
+                }
+        }
+        /**
+         * @brief 赋值构造函数
+         *
+         * @param other 赋值给此链表的链表
+         * @return 当前链表
+         * @note 时间：O(n), 空间：O(1)
+         */
+        UnrolledLinkedList& operator=(const UnrolledLinkedList& other) {
+                if(this == &other) {
+                        return *this;
+                }
+                clean();
+                copyAllocatorFrom(other, typename BlockAllocTraits::propagate_on_container_copy_assignment());
+                try {
+                        copyFrom(other);
+                } catch(...) {
+                        clean();
+                        throw;
+                }
+                return *this;
+        }
+        /**
+         * @brief 移动构造函数
+         *
+         * @param other 被接受的对象，之后置空
+         * @note 时间：O(1), 空间：O(1)
+         */
+        UnrolledLinkedList(UnrolledLinkedList&& other) noexcept:
+                _head(nullptr), _tail(nullptr), _length(0), _alloc(std::move(other._alloc)) {
+                stealBlocks(other);
+        }
+        /**
+         * @brief 移动赋值构造函数
+         *
+         * 分配器不传播且两者不相等时，退化为逐个移动元素
+         *
+         * @param other 被接受的对象，之后置空
+         * @return 自己
+         * @note 时间：O(1), 空间：O(1)；退化时 时间：O(n)
+         */
+        UnrolledLinkedList& operator=(UnrolledLinkedList&& other)
+                        noexcept(BlockAllocTraits::propagate_on_container_move_assignment::value) {
+                if(this == &other) {
+                        return *this;
+                }
+                clean();
+                if(BlockAllocTraits::propagate_on_container_move_assignment::value || _alloc == other._alloc) {
+                        moveAllocatorFrom(other, typename BlockAllocTraits::propagate_on_container_move_assignment());
+                        stealBlocks(other);
+                        return *this;
+                }
+                for(auto& data : other) {
+                        push_back(std::move(data));
+                }
+                other.clean();
+                return *this;
+        }
+        /** @} */
+
+        /**
+         * @brief 析构函数
+         *
+         * @sa clean()
+         * @note 时间：O(n), 空间：O(1)
+         */
+        ~UnrolledLinkedList() noexcept {
+                clean();
+        }
+
+        /**
+         * @brief 获取分配器
+         *
+         * @return 由_alloc重绑定回DataType得到的分配器副本
+         */
+        allocator_type get_allocator() const {
+                return allocator_type(_alloc);
+        }
+
+        class ConstIterator;
+        /**
+         * @class Iterator
+         * @brief UnrolledLinkedList的内置迭代器
+         *
+         * 由节点和节点内的位置组成
+         * 部分未做nullptr检查，出于性能考虑
+         *
+         */
+        class Iterator {
+        private:
+                Block* _block; ///< 当前节点，end()时为 nullptr
+                int _pos; ///< 节点内的位置
+                friend class UnrolledLinkedList; ///< 使UnrolledLinkedList能访问Iterator私有成员
+                friend class ConstIterator; ///< 使ConstIterator能从Iterator构造
+        public:
+                /**
+                 * @brief 对接STL
+                 * @{
+                 */
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = DataType;
+                using difference_type = std::ptrdiff_t;
+                using pointer = DataType*;
+                using reference = DataType&;
+                /** @} */
+                explicit Iterator(Block* block = nullptr, int pos = 0) noexcept: _block(block), _pos(pos){}
+                DataType& operator*() const noexcept {
+                        return _block -> data()[_pos];
+                }
+                DataType* operator->() const noexcept {
+                        return _block -> data() + _pos;
+                }
+                /**
+                 * @brief 前置递增
+                 *
+                 * 到达节点末尾时跳到下一个节点的开头
+                 *
+                 */
+                Iterator& operator++() noexcept {
+                        if(++_pos == _block -> _count) {
+                                _block = _block -> _next;
+                                _pos = 0;
+                        }
+                        return *this;
+                }
+                Iterator operator++(int) noexcept {
+                        auto temp = *this;
+                        ++*this;
+                        return temp;
+                }
+                bool operator==(const Iterator& other) const noexcept {
+                        return _block == other._block && _pos == other._pos;
+                }
+                bool operator!=(const Iterator& other) const noexcept {
+                        return !(*this == other);
+                }
+        }; ///< class Iterator
+
+        /**
+         * @class ConstIterator
+         * @brief UnrolledLinkedList的内置Const迭代器
+         *
+         * 是Iterator的const版
+         *
+         * @see Iterator
+         */
+        class ConstIterator {
+        private:
+                const Block* _block; ///< 当前节点，end()时为 nullptr
+                int _pos; ///< 节点内的位置
+                friend class UnrolledLinkedList; ///< 使UnrolledLinkedList能访问ConstIterator私有成员
+        public:
+                /**
+                 * @brief 对接STL
+                 * @{
+                 */
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = DataType;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const DataType*;
+                using reference = const DataType&;
+                /** @} */
+                explicit ConstIterator(const Block* block = nullptr, int pos = 0) noexcept: _block(block), _pos(pos){}
+                ConstIterator(const Iterator& it) noexcept: _block(it._block), _pos(it._pos){}
+                const DataType& operator*() const noexcept {
+                        return _block -> data()[_pos];
+                }
+                const DataType* operator->() const noexcept {
+                        return _block -> data() + _pos;
+                }
+                ConstIterator& operator++() noexcept {
+                        if(++_pos == _block -> _count) {
+                                _block = _block -> _next;
+                                _pos = 0;
+                        }
+                        return *this;
+                }
+                ConstIterator operator++(int) noexcept {
+                        auto temp = *this;
+                        ++*this;
+                        return temp;
+                }
+                bool operator==(const ConstIterator& other) const noexcept {
+                        return _block == other._block && _pos == other._pos;
+                }
+                bool operator!=(const ConstIterator& other) const noexcept {
+                        return !(*this == other);
+                }
+        }; ///< class ConstIterator
+
+        /**
+         * @name 迭代器
+         * @brief 与LinkedList相同的begin/end系列
+         * @{
+         */
+        Iterator begin() {
+                return Iterator(_head);
+        }
+        Iterator end() {
+                return Iterator(nullptr);
+        }
+        ConstIterator begin() const {
+                return ConstIterator(_head);
+        }
+        ConstIterator cbegin() const {
+                return ConstIterator(_head);
+        }
+        ConstIterator end() const {
+                return ConstIterator(nullptr);
+        }
+        ConstIterator cend() const {
+                return ConstIterator(nullptr);
+        }
+        /** @} */
+
+        /**
+         * @name 下标访问
+         * @brief 提供[]的下标访问
+         *
+         * 按节点跳过，每个节点只看一次_count
+         * 在所索引超出范围时抛出异常
+         *
+         * @param index 目标索引
+         * @return 所存储的数据类型
+         * @note 时间：O(n / N), 空间：O(1)
+         * @{
+         */
+        DataType& operator[](const int& index) {
+                if(index < 0 || index >= _length) {
+                        throw std::out_of_range("index out of range");
+                }
+                int pos = index;
+                Block* prev;
+                Block* block = locate(pos, prev);
+                return block -> data()[pos];
+        }
+        const DataType& operator[](const int& index) const {
+                if(index < 0 || index >= _length) {
+                        throw std::out_of_range("index out of range");
+                }
+                int pos = index;
+                Block* prev;
+                Block* block = locate(pos, prev);
+                return block -> data()[pos];
+        }
+        /** @} */
+
+        /**
+         * @brief 获取链表长度
+         *
+         * @return _length成员
+         */
+        int size() const noexcept {
+                return _length;
+        }
+        /**
+         * @brief 链表是否为空
+         *
+         * @retval true 链表为空
+         * @retval false 反之
+         */
+        bool empty() const noexcept {
+                return _head == nullptr;
+        }
+        /**
+         * @brief 清空链表
+         *
+         * 异常安全
+         *
+         * @note 时间：O(n), 空间：O(1)
+         */
+        void clean() noexcept {
+                while(_head != nullptr) {
+                        auto temp = _head;
+                        _head = _head -> _next;
+                        destroyBlock(temp);
+                }
+                _tail = nullptr;
+                _length = 0;
+        }
+
+        /**
+         * @name 寻找是否有某个值
+         * @brief 分为三个版本
+         *
+         * 在每个节点的连续数组中比较，算术类型通过SimdSearch一次比较多个元素
+         *
+         * @note 时间：O(n), 空间：O(1)
+         * @{
+         */
+
+        /**
+         * @brief 返回int版本
+         *
+         * @retval >=0 找到的索引
+         * @retval -1 未找到
+         */
+        int find_index(const DataType& data) const {
+                int base = 0;
+                for(const Block* curr = _head; curr != nullptr; curr = curr -> _next) {
+                        const int pos = SimdSearch<DataType>::find(curr -> data(), curr -> _count, data);
+                        if(pos >= 0) {
+                                return base + pos;
+                        }
+                        base += curr -> _count;
+                }
+                return -1;
+        }
+        /**
+         * @brief 返回Iterator版本
+         *
+         * @retval end() 未找到
+         */
+        Iterator find(const DataType& data) {
+                for(Block* curr = _head; curr != nullptr; curr = curr -> _next) {
+                        const int pos = SimdSearch<DataType>::find(curr -> data(), curr -> _count, data);
+                        if(pos >= 0) {
+                                return Iterator(curr, pos);
+                        }
+                }
+                return end();
+        }
+        /**
+         * @brief 返回ConstIterator版本
+         *
+         * @retval cend() 未找到
+         */
+        ConstIterator find(const DataType& data) const {
+                for(const Block* curr = _head; curr != nullptr; curr = curr -> _next) {
+                        const int pos = SimdSearch<DataType>::find(curr -> data(), curr -> _count, data);
+                        if(pos >= 0) {
+                                return ConstIterator(curr, pos);
+                        }
+                }
+                return cend();
+        }
+        /** @} */
+
+        /**
+         * @brief 统计等于data的元素个数
+         *
+         * @param data 要统计的数据
+         * @return 个数
+         * @sa SimdSearch
+         * @note 时间：O(n), 空间：O(1)
+         */
+        int count(const DataType& data) const {
+                int result = 0;
+                for(const Block* curr = _head; curr != nullptr; curr = curr -> _next) {
+                        result += SimdSearch<DataType>::count(curr -> data(), curr -> _count, data);
+                }
+                return result;
+        }
+        /**
+         * @brief 是否含有等于data的元素
+         *
+         * @param data 要寻找的数据
+         * @retval true 含有
+         * @retval false 反之
+         * @note 时间：O(n), 空间：O(1)
+         */
+        bool contains(const DataType& data) const {
+                for(const Block* curr = _head; curr != nullptr; curr = curr -> _next) {
+                        if(SimdSearch<DataType>::find(curr -> data(), curr -> _count, data) >= 0) {
+                                return true;
+                        }
+                }
+                return false;
+        }
+
+        /**
+         * @name 获取头/尾元素
+         * @brief 链表为空会抛出异常
+         * @note 时间：O(1), 空间：O(1)
+         * @{
+         */
+        DataType& front() {
+                if(empty()) {
+                        throw std::logic_error("UnrolledLinkedList is empty");
+                }
+                return _head -> data()[0];
+        }
+        const DataType& front() const {
+                if(empty()) {
+                        throw std::logic_error("UnrolledLinkedList is empty");
+                }
+                return _head -> data()[0];
+        }
+        DataType& back() {
+                if(empty()) {
+                        throw std::logic_error("UnrolledLinkedList is empty");
+                }
+                return _tail -> data()[_tail -> _count - 1];
+        }
+        const DataType& back() const {
+                if(empty()) {
+                        throw std::logic_error("UnrolledLinkedList is empty");
+                }
+                return _tail -> data()[_tail -> _count - 1];
+        }
+        /** @} */
+
+        /**
+         * @name 原地构造
+         * @brief 用传入的参数直接构造新元素
+         *
+         * @param args 转发给DataType构造函数的参数
+         * @return 新元素的引用
+         * @{
+         */
+
+        /**
+         * @brief 在头部构造
+         *
+         * 头结点已满时在前面新建一个节点
+         *
+         * @note 时间：O(N), 空间：O(1)
+         */
+        template<typename... Args>
+        DataType& emplace_front(Args&&... args) {
+                if(_head != nullptr && _head -> _count < N) {
+                        return emplaceInBlock(_head, 0, std::forward<Args>(args)...);
+                }
+                Block* block = insertBlockAfter(nullptr);
+                try {
+                        return emplaceInBlock(block, 0, std::forward<Args>(args)...);
+                } catch(...) {
+                        unlinkBlock(nullptr, block);
+                        throw;
+                }
+        }
+        /**
+         * @brief 在尾部构造
+         *
+         * 尾结点已满时在后面新建一个节点
+         *
+         * @note 时间：O(1), 空间：O(1)
+         */
+        template<typename... Args>
+        DataType& emplace_back(Args&&... args) {
+                if(_tail != nullptr && _tail -> _count < N) {
+                        return emplaceInBlock(_tail, _tail -> _count, std::forward<Args>(args)...);
+                }
+                Block* prev = _tail;
+                Block* block = insertBlockAfter(prev);
+                try {
+                        return emplaceInBlock(block, 0, std::forward<Args>(args)...);
+                } catch(...) {
+                        unlinkBlock(prev, block);
+                        throw;
+                }
+        }
+        /** @} */
+
+        /**
+         * @name 头/尾/指定位置插入
+         * @brief 分为拷贝和移动两个版本
+         *
+         * @sa emplace_front() emplace_back() emplaceAt()
+         * @{
+         */
+        void push_front(const DataType& data) {
+                emplace_front(data);
+        }
+        void push_front(DataType&& data) {
+                emplace_front(std::move(data));
+        }
+        void push_back(const DataType& data) {
+                emplace_back(data);
+        }
+        void push_back(DataType&& data) {
+                emplace_back(std::move(data));
+        }
+        /**
+         * @brief 指定位置插入
+         *
+         * 插入后新元素的索引为index
+         * 当索引超出范围时抛出异常
+         *
+         * @note 时间：O(n / N + N), 空间：O(1)
+         */
+        void insert(int index, const DataType& data) {
+                emplaceAt(index, data);
+        }
+        void insert(int index, DataType&& data) {
+                emplaceAt(index, std::move(data));
+        }
+        /** @} */
+
+        /**
+         * @brief 头删除
+         *
+         * 链表为空时抛出异常
+         *
+         * @note 时间：O(N), 空间：O(1)
+         */
+        void pop_front() {
+                if(empty()) {
+                        throw std::logic_error("cannot pop from empty list");
+                }
+                eraseInBlock(nullptr, _head, 0);
+        }
+        /**
+         * @brief 尾删除
+         *
+         * 链表为空时抛出异常
+         * 尾结点变空时需要找到它的前一个节点
+         *
+         * @note 时间：O(1)；尾结点变空时 O(n / N), 空间：O(1)
+         */
+        void pop_back() {
+                if(empty()) {
+                        throw std::logic_error("cannot pop from empty list");
+                }
+                _tail -> data()[_tail -> _count - 1].~DataType();
+                _tail -> _count--;
+                _length--;
+                if(_tail -> _count > 0) {
+                        return;
+                }
+                Block* prev = nullptr;
+                for(Block* curr = _head; curr != _tail; curr = curr -> _next) {
+                        prev = curr;
+                }
+                unlinkBlock(prev, _tail);
+        }
+        /**
+         * @brief 删除指定元素
+         *
+         * 索引超出范围时抛出异常
+         *
+         * @param index 要删除的元素的索引
+         * @note 时间：O(n / N + N), 空间：O(1)
+         */
+        void erase(int index) {
+                if(index < 0 || index >= _length) {
+                        throw std::out_of_range("index out of range");
+                }
+                Block* prev;
+                Block* block = locate(index, prev);
+                eraseInBlock(prev, block, index);
+        }
+        /**
+         * @brief 删除所有使pred返回true的元素
+         *
+         * 逐个节点把保留下来的元素前移，相对顺序不变，变空的节点随即删除
+         * 只在节点内移动，不跨节点合并，删除较多时节点可能不足半满
+         * pred或移动抛出异常时，已删除的元素不会恢复，链表仍然有效
+         *
+         * @param pred 一元谓词
+         * @return 删除的元素个数
+         * @note 时间：O(n), 空间：O(1)
+         */
+        template<typename Predicate>
+        int remove_if(Predicate pred) {
+                int removed = 0;
+                Block* prev = nullptr;
+                Block* block = _head;
+                while(block != nullptr) {
+                        DataType* d = block -> data();
+                        int kept = 0;
+                        int i = 0;
+                        try {
+                                for(; i < block -> _count; i++) {
+                                        if(pred(d[i])) {
+                                                continue;
+                                        }
+                                        if(kept != i) {
+                                                d[kept] = std::move(d[i]);
+                                        }
+                                        kept++;
+                                }
+                        } catch(...) {
+                                kept = static_cast<int>(std::move(d + i, d + block -> _count, d + kept) - d); // 未检查的元素保留
+                                removed += block -> _count - kept;
+                                shrinkBlock(prev, block, kept);
+                                throw;
+                        }
+                        removed += block -> _count - kept;
+                        Block* next = block -> _next;
+                        if(!shrinkBlock(prev, block, kept)) {
+                                prev = block;
+                        }
+                        block = next;
+                }
+                return removed;
+        }
+        /**
+         * @brief 尾部拼接整个链表
+         *
+         * 分配器相等时直接把other的节点接在_tail之后，不移动元素
+         * 否则无法互相释放节点，逐个把元素移动到此链表中，
+         * 抛出异常时已移动的元素留在此链表中，other随后仍会清空
+         *
+         * @param other 被拼接的链表，随后为空
+         * @note 时间：O(1)；分配器不相等时 O(m), 空间：O(1)
+         */
+        void append(UnrolledLinkedList&& other) noexcept(BlockAllocTraits::is_always_equal::value) {
+                if(this == &other || other._head == nullptr) {
+                        return;
+                }
+                if(!(_alloc == other._alloc)) {
+                        appendByMove(other);
+                        return;
+                }
+                if(_head == nullptr) {
+                        stealBlocks(other);
+                        return;
+                }
+                _tail -> _next = other._head;
+                _tail = other._tail;
+                _length += other._length;
+                other._head = nullptr;
+                other._tail = nullptr;
+                other._length = 0;
+        }
+}; ///< class UnrolledLinkedList
@@ -0,0 +1,166 @@
+#pragma once
+// 无依赖的基准测试框架，供benchmarks/下的各程序共用
+// 每个测试先运行若干次预热，再重复测量，报告每次操作耗时(ns)的分位数，结果以JSON输出
+// 命令行参数：
+//   --warmup N       预热次数，默认2
+//   --reps N         测量次数，默认15
+//   --sizes a,b,c    规模列表，默认由调用者给出
+//   --filter s       只运行名称(操作/实现/数据类型)中含有s的测试
+//   --out file       JSON写入文件，默认写到标准输出
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// 阻止编译器把结果当作无用代码删掉
+template<typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const void* sink;
+        sink = &value;
+#endif
+}
+
+class Harness {
+public:
+        struct Result {
+                std::string op, impl, payload;
+                int size;
+                long ops; // 每次测量包含的操作数
+                std::vector<double> nsPerOp; // 每次测量的平均单次操作耗时，已排序
+        };
+
+        Harness(int argc, char** argv, std::vector<int> defaultSizes): _warmup(2), _reps(15), _sizes(std::move(defaultSizes)) {
+                for(int i = 1; i < argc; i++) {
+                        std::string arg = argv[i];
+                        const char* value = i + 1 < argc? argv[i + 1]: nullptr;
+                        if(value == nullptr) {
+                                usage(argv[0]);
+                        }
+                        if(arg == "--warmup") {
+                                _warmup = std::atoi(value);
+                        } else if(arg == "--reps") {
+                                _reps = std::max(1, std::atoi(value));
+                        } else if(arg == "--sizes") {
+                                _sizes.clear();
+                                std::stringstream ss(value);
+                                std::string item;
+                                while(std::getline(ss, item, ',')) {
+                                        _sizes.push_back(static_cast<int>(std::atof(item.c_str())));
+                                }
+                        } else if(arg == "--filter") {
+                                _filter = value;
+                        } else if(arg == "--out") {
+                                _out = value;
+                        } else {
+                                usage(argv[0]);
+                        }
+                        i++;
+                }
+        }
+
+        const std::vector<int>& sizes() const {
+                return _sizes;
+        }
+
+        // setup()构造被测状态，不计时；body(state)被计时；state在计时结束后析构
+        // ops为body中包含的操作数，用于换算单次操作耗时
+        template<typename Setup, typename Body>
+        void run(const std::string& op, const std::string& impl, const std::string& payload,
+                 int size, long ops, Setup setup, Body body) {
+                if(!_filter.empty() && (op + "/" + impl + "/" + payload).find(_filter) == std::string::npos) {
+                        return;
+                }
+                Result result{op, impl, payload, size, ops, {}};
+                for(int rep = -_warmup; rep < _reps; rep++) {
+                        auto state = setup();
+                        auto start = std::chrono::steady_clock::now();
+                        body(state);
+                        auto end = std::chrono::steady_clock::now();
+                        doNotOptimize(state);
+                        if(rep >= 0) {
+                                double ns = std::chrono::duration<double, std::nano>(end - start).count();
+                                result.nsPerOp.push_back(ns / std::max(1L, ops));
+                        }
+                }
+                std::sort(result.nsPerOp.begin(), result.nsPerOp.end());
+                std::cerr << op << "\t" << impl << "\t" << payload << "\t" << size
+                          << "\t" << percentile(result.nsPerOp, 50) << " ns/op\n";
+                _results.push_back(std::move(result));
+        }
+
+        // 输出全部结果，返回进程退出码
+        int report(const char* suite) const {
+                if(_out.empty()) {
+                        write(std::cout, suite);
+                        return 0;
+                }
+                std::ofstream file(_out);
+                write(file, suite);
+                return file? 0: 1;
+        }
+
+private:
+        int _warmup, _reps;
+        std::vector<int> _sizes;
+        std::string _filter, _out;
+        std::vector<Result> _results;
+
+        static void usage(const char* prog) {
+                std::cerr << "usage: " << prog
+                          << " [--warmup N] [--reps N] [--sizes a,b,c] [--filter s] [--out file]\n";
+                std::exit(2);
+        }
+
+        // 最近秩法，sorted已升序排列
+        static double percentile(const std::vector<double>& sorted, int p) {
+                size_t rank = (sorted.size() * p + 99) / 100;
+                return sorted[rank == 0? 0: rank - 1];
+        }
+
+        static std::string quote(const std::string& s) {
+                std::string out = "\"";
+                for(char c : s) {
+                        if(c == '"' || c == '\\') {
+                                out += '\\';
+                        }
+                        out += c;
+                }
+                return out + "\"";
+        }
+
+        void write(std::ostream& os, const char* suite) const {
+                os << "{\n  \"suite\": " << quote(suite)
+                   << ",\n  \"warmup\": " << _warmup
+                   << ",\n  \"reps\": " << _reps
+                   << ",\n  \"results\": [";
+                for(size_t i = 0; i < _results.size(); i++) {
+                        const Result& r = _results[i];
+                        double mean = 0;
+                        for(double ns : r.nsPerOp) {
+                                mean += ns;
+                        }
+                        mean /= r.nsPerOp.size();
+                        os << (i == 0? "\n": ",\n")
+                           << "    {\"op\": " << quote(r.op)
+                           << ", \"impl\": " << quote(r.impl)
+                           << ", \"payload\": " << quote(r.payload)
+                           << ", \"size\": " << r.size
+                           << ", \"ops\": " << r.ops
+                           << ", \"ns_per_op\": {\"min\": " << r.nsPerOp.front()
+                           << ", \"p50\": " << percentile(r.nsPerOp, 50)
+                           << ", \"p90\": " << percentile(r.nsPerOp, 90)
+                           << ", \"p99\": " << percentile(r.nsPerOp, 99)
+                           << ", \"max\": " << r.nsPerOp.back()
+                           << ", \"mean\": " << mean << "}}";
+                }
+                os << "\n  ]\n}\n";
+        }
+};
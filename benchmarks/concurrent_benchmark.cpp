@@ -0,0 +1,90 @@
+// 对比 ConcurrentLinkedList 与 "std::mutex + LinkedList" 在 1..N 个线程下的吞吐量
+// 负载：在1024个键上 80% contains / 10% insert / 10% erase
+// 编译: g++ -O2 -pthread concurrent_benchmark.cpp -o concurrent_benchmark
+// 运行: ./concurrent_benchmark [最大线程数，默认为硬件线程数] [每线程操作数，默认200000]
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <chrono>
+#include <cstdlib>
+#include "../LinkedList.hpp"
+#include "../ConcurrentLinkedList.hpp"
+using std::cout;
+
+const int KeyRange = 1024;
+
+class MutexList { // 用一把全局锁保护的LinkedList，当作集合使用
+private:
+        std::mutex _mutex;
+        LinkedList<int> _list;
+public:
+        bool insert(int key) {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if(_list.find_index(key) >= 0) {
+                        return false;
+                }
+                _list.push_front(key);
+                return true;
+        }
+        bool erase(int key) {
+                std::lock_guard<std::mutex> lock(_mutex);
+                int index = _list.find_index(key);
+                if(index < 0) {
+                        return false;
+                }
+                _list.erase(index);
+                return true;
+        }
+        bool contains(int key) {
+                std::lock_guard<std::mutex> lock(_mutex);
+                return _list.find_index(key) >= 0;
+        }
+};
+
+template<typename Set>
+double run(int threads, int opsPerThread) {
+        Set set;
+        for(int key = 0; key < KeyRange; key += 2) {
+                set.insert(key);
+        }
+        std::vector<std::thread> workers;
+        auto start = std::chrono::steady_clock::now();
+        for(int t = 0; t < threads; t++) {
+                workers.emplace_back([&set, t, opsPerThread] {
+                        unsigned seed = 2654435761u * (t + 1);
+                        for(int i = 0; i < opsPerThread; i++) {
+                                seed = seed * 1103515245u + 12345u;
+                                int key = (seed >> 8) % KeyRange;
+                                int op = (seed >> 24) % 10;
+                                if(op == 0) {
+                                        set.insert(key);
+                                } else if(op == 1) {
+                                        set.erase(key);
+                                } else {
+                                        set.contains(key);
+                                }
+                        }
+                });
+        }
+        for(auto& worker : workers) {
+                worker.join();
+        }
+        auto end = std::chrono::steady_clock::now();
+        double seconds = std::chrono::duration<double>(end - start).count();
+        return threads * static_cast<double>(opsPerThread) / seconds / 1e6;
+}
+
+int main(int argc, char** argv) {
+        int maxThreads = argc > 1? std::atoi(argv[1]): static_cast<int>(std::thread::hardware_concurrency());
+        int opsPerThread = argc > 2? std::atoi(argv[2]): 200000;
+        if(maxThreads < 1) {
+                maxThreads = 1;
+        }
+        cout << "threads\tlock-free Mops/s\tmutex Mops/s\n";
+        for(int threads = 1; threads <= maxThreads; threads = threads < maxThreads && threads * 2 > maxThreads? maxThreads: threads * 2) {
+                cout << threads << "\t" << run<ConcurrentLinkedList<int>>(threads, opsPerThread)
+                     << "\t" << run<MutexList>(threads, opsPerThread) << "\n";
+        }
+        return 0;
+}
@@ -0,0 +1,87 @@
+// ConcurrentLinkedList 的多线程压力测试，配合 ThreadSanitizer 检查数据竞争和内存回收
+// 负载：N个线程在同一链表上随机 insert / erase / contains
+// 每个线程只增删 key % N == 线程号 的键，因此能准确预期自己每次操作的结果
+// contains 则在全部键上进行，与其他线程的增删并发
+// 编译: g++ -std=c++17 -O1 -g -fsanitize=thread -pthread concurrent_stress.cpp -o concurrent_stress
+// 运行: ./concurrent_stress [线程数，默认为硬件线程数] [每线程操作数，默认200000]
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <cstdlib>
+#include "../ConcurrentLinkedList.hpp"
+using std::cout;
+
+const int KeyRange = 512;
+
+int main(int argc, char** argv) {
+        int threads = argc > 1? std::atoi(argv[1]): static_cast<int>(std::thread::hardware_concurrency());
+        int opsPerThread = argc > 2? std::atoi(argv[2]): 200000;
+        if(threads < 2) {
+                threads = 2;
+        }
+        ConcurrentLinkedList<int> set;
+        std::vector<std::vector<char>> present(threads, std::vector<char>(KeyRange, 0)); // 每个线程自己的键当前是否在链表中
+        std::atomic<int> errors(0);
+        std::atomic<int> ready(0);
+        std::vector<std::thread> workers;
+        for(int t = 0; t < threads; t++) {
+                workers.emplace_back([&, t] {
+                        std::vector<char>& mine = present[t];
+                        unsigned seed = 2654435761u * (t + 1);
+                        ready.fetch_add(1);
+                        while(ready.load() < threads) {
+                                std::this_thread::yield();
+                        }
+                        for(int i = 0; i < opsPerThread; i++) {
+                                seed = seed * 1103515245u + 12345u;
+                                int key = (seed >> 8) % KeyRange;
+                                int op = (seed >> 24) % 4;
+                                if(op == 0 || op == 1) {
+                                        key = key - key % threads + t; // 换成自己的键
+                                        if(key >= KeyRange) {
+                                                continue;
+                                        }
+                                        bool changed = op == 0? set.insert(key): set.erase(key);
+                                        if(changed != (mine[key] == (op == 0? 0: 1))) {
+                                                errors.fetch_add(1);
+                                        }
+                                        if(changed) {
+                                                mine[key] = op == 0? 1: 0;
+                                        }
+                                } else if(key % threads == t) {
+                                        if(set.contains(key) != (mine[key] == 1)) {
+                                                errors.fetch_add(1);
+                                        }
+                                } else {
+                                        set.contains(key);
+                                }
+                        }
+                });
+        }
+        for(auto& worker : workers) {
+                worker.join();
+        }
+        int expected = 0;
+        for(int key = 0; key < KeyRange; key++) {
+                bool inSet = present[key % threads][key] == 1;
+                expected += inSet? 1: 0;
+                if(set.contains(key) != inSet) {
+                        errors.fetch_add(1);
+                }
+        }
+        if(set.size() != expected) {
+                errors.fetch_add(1);
+        }
+        int previous = -1;
+        int popped;
+        while(set.pop_front(popped)) { // 按升序取出
+                if(popped <= previous) {
+                        errors.fetch_add(1);
+                }
+                previous = popped;
+        }
+        cout << threads << " threads x " << opsPerThread << " ops, " << expected << " keys left, "
+             << errors.load() << " errors\n";
+        return errors.load() == 0? 0: 1;
+}
@@ -0,0 +1,87 @@
+// 比较 IndexedLinkedList 与 LinkedList 的随机位置访问/插入/删除，以及有序链表上的按值查找
+// 编译: g++ -std=c++17 -O2 indexed_benchmark.cpp -o indexed_benchmark
+// 运行: ./indexed_benchmark [--sizes 1e5,1e6,1e7] [--reps 15] [--warmup 2] [--filter insert] [--out result.json]
+// LinkedList 的每次随机操作是O(n)，规模为1e7时一次测量需要数秒，可以用 --filter IndexedLinkedList 只测索引版本
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include "bench.hpp"
+#include "../LinkedList.hpp"
+#include "../IndexedLinkedList.hpp"
+using std::string;
+
+const long RandomOps = 100; // 每次测量的随机操作数
+
+template<typename C> struct Impl;
+template<> struct Impl<LinkedList<int>> { static const char* name() { return "LinkedList"; } };
+template<> struct Impl<IndexedLinkedList<int>> { static const char* name() { return "IndexedLinkedList"; } };
+
+template<typename C> constexpr bool isIndexed = false;
+template<> constexpr bool isIndexed<IndexedLinkedList<int>> = true;
+
+// 元素为0, 2, 4, ...，保持有序，奇数用于查找不存在的值
+template<typename C>
+C build(int n) {
+        C c;
+        for(int i = 0; i < n; i++) {
+                c.push_back(2 * i);
+        }
+        return c;
+}
+
+template<typename C>
+int findValue(const C& c, int value) {
+        if constexpr(isIndexed<C>) {
+                return c.find_sorted(value);
+        } else {
+                return c.find_index(value);
+        }
+}
+
+template<typename C>
+void runContainer(Harness& h, int n, const std::vector<int>& positions) {
+        const string impl = Impl<C>::name();
+        const long ops = static_cast<long>(positions.size());
+        auto full = [&] { return build<C>(n); };
+
+        h.run("operator[]", impl, "int", n, ops, full, [&](C& c) {
+                std::int64_t sum = 0;
+                for(int p : positions) {
+                        sum += c[p];
+                }
+                doNotOptimize(sum);
+        });
+        h.run("insert", impl, "int", n, ops, full, [&](C& c) {
+                for(int p : positions) {
+                        c.insert(p, p);
+                }
+        });
+        h.run("erase", impl, "int", n, ops, full, [&](C& c) {
+                int size = n;
+                for(int p : positions) {
+                        c.erase(p % size--);
+                }
+        });
+        h.run("find_sorted", impl, "int", n, ops, full, [&](C& c) {
+                long sum = 0;
+                for(int p : positions) {
+                        sum += findValue(c, p);
+                }
+                doNotOptimize(sum);
+        });
+}
+
+int main(int argc, char** argv) {
+        Harness h(argc, argv, {100000, 1000000});
+        for(int n : h.sizes()) {
+                std::mt19937 rng(n);
+                std::vector<int> positions(std::min<long>(RandomOps, n));
+                for(auto& p : positions) {
+                        p = static_cast<int>(rng() % n);
+                }
+                runContainer<IndexedLinkedList<int>>(h, n, positions);
+                runContainer<LinkedList<int>>(h, n, positions);
+        }
+        return h.report("indexed");
+}
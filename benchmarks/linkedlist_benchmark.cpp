@@ -0,0 +1,253 @@
+// 测量 LinkedList 各操作的耗时，并以 std::forward_list / std::list / std::vector 作为基准
+// 数据类型：int、64字节POD、std::string(超出短字符串优化，需要堆分配)
+// 编译: g++ -std=c++17 -O2 linkedlist_benchmark.cpp -o linkedlist_benchmark
+// 运行: ./linkedlist_benchmark [--sizes 1000,10000,100000] [--reps 15] [--warmup 2] [--filter push] [--out result.json]
+// 结果为JSON，可以保存下来与之后的运行对比
+#include <cstdint>
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <optional>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "bench.hpp"
+#include "../LinkedList.hpp"
+using std::string;
+
+const long RandomOps = 200; // insert/erase/pop_back/find/operator[] 每次测量的操作数
+
+struct Pod64 {
+        std::int64_t value[8];
+        bool operator==(const Pod64& other) const {
+                return value[0] == other.value[0];
+        }
+        bool operator!=(const Pod64& other) const {
+                return !(*this == other);
+        }
+};
+
+// 由整数生成各类型的值，以及从值取回整数用于累加
+template<typename T> T makeValue(int i);
+template<> int makeValue<int>(int i) {
+        return i;
+}
+template<> Pod64 makeValue<Pod64>(int i) {
+        Pod64 pod;
+        for(auto& v : pod.value) {
+                v = i;
+        }
+        return pod;
+}
+template<> string makeValue<string>(int i) {
+        return "payload-string-" + std::to_string(i) + "-xxxxxxxxxxxxxxxx";
+}
+inline std::int64_t key(int v) {
+        return v;
+}
+inline std::int64_t key(const Pod64& v) {
+        return v.value[0];
+}
+inline std::int64_t key(const string& v) {
+        return static_cast<std::int64_t>(v.size());
+}
+
+template<typename T> const char* payloadName();
+template<> const char* payloadName<int>() { return "int"; }
+template<> const char* payloadName<Pod64>() { return "pod64"; }
+template<> const char* payloadName<string>() { return "string"; }
+
+template<typename C> struct Impl;
+template<typename T> struct Impl<LinkedList<T>> { static const char* name() { return "LinkedList"; } };
+template<typename T> struct Impl<std::forward_list<T>> { static const char* name() { return "forward_list"; } };
+template<typename T> struct Impl<std::list<T>> { static const char* name() { return "list"; } };
+template<typename T> struct Impl<std::vector<T>> { static const char* name() { return "vector"; } };
+
+template<typename C> constexpr bool isLinkedList = false;
+template<typename T> constexpr bool isLinkedList<LinkedList<T>> = true;
+template<typename C> constexpr bool isForwardList = false;
+template<typename T> constexpr bool isForwardList<std::forward_list<T>> = true;
+template<typename C> constexpr bool isVector = false;
+template<typename T> constexpr bool isVector<std::vector<T>> = true;
+
+// 各容器的统一接口，容器不支持的操作不会被调用
+template<typename C>
+auto positionBefore(C& c, int index) {
+        if constexpr(isForwardList<C>) {
+                return std::next(c.before_begin(), index);
+        } else {
+                return std::next(c.begin(), index);
+        }
+}
+
+template<typename C, typename T>
+void insertAt(C& c, int index, const T& value) {
+        if constexpr(isLinkedList<C>) {
+                c.insert(index, value);
+        } else if constexpr(isForwardList<C>) {
+                c.insert_after(positionBefore(c, index), value);
+        } else {
+                c.insert(positionBefore(c, index), value);
+        }
+}
+
+template<typename C>
+void eraseAt(C& c, int index) {
+        if constexpr(isLinkedList<C>) {
+                c.erase(index);
+        } else if constexpr(isForwardList<C>) {
+                c.erase_after(positionBefore(c, index));
+        } else {
+                c.erase(positionBefore(c, index));
+        }
+}
+
+template<typename C>
+decltype(auto) at(const C& c, int index) {
+        if constexpr(isLinkedList<C> || isVector<C>) {
+                return c[index];
+        } else {
+                return *std::next(c.begin(), index);
+        }
+}
+
+template<typename C, typename T>
+bool contains(const C& c, const T& value) {
+        if constexpr(isLinkedList<C>) {
+                return c.find(value) != c.end();
+        } else {
+                return std::find(c.begin(), c.end(), value) != c.end();
+        }
+}
+
+template<typename C>
+void clear(C& c) {
+        if constexpr(isLinkedList<C>) {
+                c.clean();
+        } else {
+                c.clear();
+        }
+}
+
+template<typename C, typename T>
+C build(const std::vector<T>& values) {
+        C c;
+        if constexpr(isForwardList<C>) {
+                c.assign(values.begin(), values.end());
+        } else {
+                for(const auto& v : values) {
+                        c.push_back(v);
+                }
+        }
+        return c;
+}
+
+template<typename C, typename T>
+void runContainer(Harness& h, int n) {
+        const string impl = Impl<C>::name();
+        const string payload = payloadName<T>();
+        std::vector<T> values;
+        values.reserve(n);
+        for(int i = 0; i < n; i++) {
+                values.push_back(makeValue<T>(i));
+        }
+        const long randomOps = std::min<long>(RandomOps, n);
+        std::mt19937 rng(n);
+        std::vector<int> positions(randomOps);
+        for(auto& p : positions) {
+                p = static_cast<int>(rng() % n);
+        }
+        auto empty = [] { return C(); };
+        auto full = [&] { return build<C>(values); };
+
+        if constexpr(!isVector<C>) {
+                h.run("push_front", impl, payload, n, n, empty, [&](C& c) {
+                        for(int i = 0; i < n; i++) {
+                                c.push_front(values[i]);
+                        }
+                });
+        }
+        if constexpr(!isForwardList<C>) {
+                h.run("push_back", impl, payload, n, n, empty, [&](C& c) {
+                        for(int i = 0; i < n; i++) {
+                                c.push_back(values[i]);
+                        }
+                });
+        }
+        h.run("insert", impl, payload, n, randomOps, full, [&](C& c) {
+                for(int p : positions) {
+                        insertAt(c, p, values[p]);
+                }
+        });
+        h.run("erase", impl, payload, n, randomOps, full, [&](C& c) {
+                int size = n;
+                for(int p : positions) {
+                        eraseAt(c, p % size--);
+                }
+        });
+        if constexpr(!isForwardList<C>) {
+                h.run("pop_back", impl, payload, n, randomOps, full, [&](C& c) {
+                        for(long i = 0; i < randomOps; i++) {
+                                c.pop_back();
+                        }
+                });
+        }
+        h.run("find", impl, payload, n, randomOps, full, [&](C& c) {
+                long hits = 0;
+                for(int p : positions) {
+                        hits += contains(c, values[p]);
+                }
+                doNotOptimize(hits);
+        });
+        if constexpr(isLinkedList<C>) {
+                h.run("find_index", impl, payload, n, randomOps, full, [&](C& c) {
+                        long sum = 0;
+                        for(int p : positions) {
+                                sum += c.find_index(values[p]);
+                        }
+                        doNotOptimize(sum);
+                });
+        }
+        h.run("operator[]", impl, payload, n, randomOps, full, [&](C& c) {
+                std::int64_t sum = 0;
+                for(int p : positions) {
+                        sum += key(at(c, p));
+                }
+                doNotOptimize(sum);
+        });
+        h.run("iterate", impl, payload, n, n, full, [&](C& c) {
+                std::int64_t sum = 0;
+                for(const auto& v : c) {
+                        sum += key(v);
+                }
+                doNotOptimize(sum);
+        });
+        // 副本放在状态中，在计时结束后才析构，只计拷贝本身
+        auto fullAndEmpty = [&] { return std::make_pair(full(), std::optional<C>()); };
+        h.run("copy", impl, payload, n, n, fullAndEmpty, [&](std::pair<C, std::optional<C>>& state) {
+                state.second.emplace(state.first);
+        });
+        h.run("clean", impl, payload, n, n, full, [&](C& c) {
+                clear(c);
+        });
+}
+
+template<typename T>
+void runPayload(Harness& h, int n) {
+        runContainer<LinkedList<T>, T>(h, n);
+        runContainer<std::forward_list<T>, T>(h, n);
+        runContainer<std::list<T>, T>(h, n);
+        runContainer<std::vector<T>, T>(h, n);
+}
+
+int main(int argc, char** argv) {
+        Harness h(argc, argv, {1000, 10000, 100000});
+        for(int n : h.sizes()) {
+                runPayload<int>(h, n);
+                runPayload<Pod64>(h, n);
+                runPayload<string>(h, n);
+        }
+        return h.report("linkedlist");
+}
@@ -0,0 +1,52 @@
+// 测量 LinkedList::parallel_sort() 从1个线程到 hardware_concurrency() 个线程的扩展性，以 sort() 为基准
+// 编译: g++ -std=c++17 -O2 -pthread parallel_sort_benchmark.cpp -o parallel_sort_benchmark
+// 运行: ./parallel_sort_benchmark [--sizes 1e6,1e7] [--reps 15] [--warmup 2] [--filter threads=8] [--out result.json]
+// 每次测量前拷贝一份未排序的链表(不计时)
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "bench.hpp"
+#include "../ThreadPool.hpp"
+#include "../LinkedList.hpp"
+using std::string;
+
+template<typename T, typename Gen>
+void run(Harness& h, const char* payload, int n, Gen gen) {
+        std::mt19937 rng(n);
+        LinkedList<T> unsorted;
+        for(int i = 0; i < n; i++) {
+                unsorted.push_back(gen(rng));
+        }
+        auto copy = [&] { return LinkedList<T>(unsorted); };
+        h.run("sort", "sort()", payload, n, n, copy, [](LinkedList<T>& l) {
+                l.sort();
+        });
+        std::vector<unsigned> threads;
+        const unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+        for(unsigned t = 1; t < hardware; t *= 2) {
+                threads.push_back(t);
+        }
+        threads.push_back(hardware);
+        for(unsigned t : threads) {
+                ThreadPool pool(t);
+                h.run("parallel_sort", "threads=" + std::to_string(t), payload, n, n, copy, [&](LinkedList<T>& l) {
+                        l.parallel_sort(pool, [](const T& a, const T& b) { return a < b; });
+                });
+        }
+}
+
+int main(int argc, char** argv) {
+        Harness h(argc, argv, {1000000, 10000000});
+        for(int n : h.sizes()) {
+                run<int>(h, "int", n, [](std::mt19937& rng) { return static_cast<int>(rng()); });
+                run<string>(h, "string", n, [](std::mt19937& rng) {
+                        string s(16, 'a');
+                        for(auto& c : s) {
+                                c = static_cast<char>('a' + rng() % 26);
+                        }
+                        return s;
+                });
+        }
+        return h.report("parallel_sort");
+}
@@ -0,0 +1,66 @@
+// 对比 LinkedList::sort() 与 "拷贝到vector -> std::sort -> push_back重建" 的耗时
+// 编译: g++ -O2 sort_benchmark.cpp -o sort_benchmark
+// 运行: ./sort_benchmark [最大规模，默认10000000]
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <random>
+#include <chrono>
+#include <cstdlib>
+#include "../LinkedList.hpp"
+using std::cout;
+using std::string;
+
+template<typename F>
+double measureMs(F f) {
+        auto start = std::chrono::steady_clock::now();
+        f();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int randomInt(std::mt19937& gen) {
+        return static_cast<int>(gen());
+}
+
+string randomString(std::mt19937& gen) {
+        string s(16, 'a');
+        for(auto& c : s) {
+                c = static_cast<char>('a' + gen() % 26);
+        }
+        return s;
+}
+
+template<typename T, typename Gen>
+void run(const char* name, int n, Gen gen) {
+        std::mt19937 rng(n);
+        LinkedList<T> a;
+        for(int i = 0; i < n; i++) {
+                a.push_back(gen(rng));
+        }
+        LinkedList<T> b(a);
+
+        double inPlace = measureMs([&] {
+                a.sort();
+        });
+        double viaVector = measureMs([&] {
+                std::vector<T> v(b.begin(), b.end());
+                std::sort(v.begin(), v.end());
+                b.clean();
+                for(auto& x : v) {
+                        b.push_back(std::move(x));
+                }
+        });
+        cout << name << "\t" << n << "\t" << inPlace << "\t" << viaVector << "\n";
+}
+
+int main(int argc, char** argv) {
+        int maxSize = argc > 1? std::atoi(argv[1]): 10000000;
+        cout << "type\tsize\tsort() ms\tvector ms\n";
+        for(int n = 1000; n <= maxSize; n *= 10) {
+                run<int>("int", n, randomInt);
+                run<string>("string", n, randomString);
+        }
+        return 0;
+}
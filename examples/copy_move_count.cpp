@@ -0,0 +1,74 @@
+// 统计元素的拷贝和移动次数，确认插入时没有多余的拷贝
+// 编译: g++ -std=c++11 copy_move_count.cpp -o copy_move_count
+#include <cassert>
+#include <iostream>
+#include <string>
+#include <utility>
+#include "../LinkedList.hpp"
+using std::cout;
+using std::string;
+
+struct Tracked { // 记录被拷贝、移动了多少次的元素
+        static int copies;
+        static int moves;
+        string _value;
+        Tracked(const char* value): _value(value) {}
+        Tracked(const string& a, const string& b): _value(a + b) {}
+        Tracked(const Tracked& other): _value(other._value) {
+                copies++;
+        }
+        Tracked(Tracked&& other) noexcept: _value(std::move(other._value)) {
+                moves++;
+        }
+        Tracked& operator=(const Tracked&) = default;
+        Tracked& operator=(Tracked&&) = default;
+        static void reset() {
+                copies = 0;
+                moves = 0;
+        }
+};
+int Tracked::copies = 0;
+int Tracked::moves = 0;
+
+void check(const char* what, int copies, int moves) { // 检查并输出上一步的次数
+        cout << what << ": " << Tracked::copies << " copies, " << Tracked::moves << " moves\n";
+        assert(Tracked::copies == copies && Tracked::moves == moves);
+        Tracked::reset();
+}
+
+int main() {
+        LinkedList<Tracked> tl; // trackedList
+        Tracked value("value");
+        Tracked::reset();
+
+        tl.push_back(value);
+        check("push_back(const&)", 1, 0);
+        tl.push_front(value);
+        check("push_front(const&)", 1, 0);
+        tl.insert(1, value);
+        check("insert(const&)", 1, 0);
+        tl.insert_after(tl.cbegin(), value);
+        check("insert_after(const&)", 1, 0);
+
+        tl.push_back(Tracked("temp"));
+        check("push_back(&&)", 0, 1);
+        tl.push_front(Tracked("temp"));
+        check("push_front(&&)", 0, 1);
+        tl.insert(1, Tracked("temp"));
+        check("insert(&&)", 0, 1);
+        tl.insert_after(tl.cbegin(), Tracked("temp"));
+        check("insert_after(&&)", 0, 1);
+
+        tl.emplace_back("in place");
+        check("emplace_back", 0, 0);
+        tl.emplace_front("in", " place");
+        check("emplace_front", 0, 0);
+        tl.emplace_after(tl.cbegin(), "in place");
+        check("emplace_after", 0, 0);
+
+        LinkedList<Tracked> moved(std::move(tl));
+        check("move construction", 0, 0);
+        tl = std::move(moved);
+        check("move assignment", 0, 0);
+        return 0;
+}
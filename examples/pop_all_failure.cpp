@@ -0,0 +1,169 @@
+// pop_all() 构造链表失败时，ConcurrentStack 和 MPSCQueue 都应保留尚未交出的元素
+// 用可控的 operator new 和移动构造模拟失败，建议配合 AddressSanitizer 检查泄漏和重复释放
+// 编译: g++ -std=c++11 -g -fsanitize=address -pthread pop_all_failure.cpp -o pop_all_failure
+#include <atomic>
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <thread>
+#include "../ConcurrentStack.hpp"
+#include "../MPSCQueue.hpp"
+using std::cout;
+
+thread_local int allocBudget = -1; // 本线程还能成功分配几次，-1表示不限
+
+void* operator new(std::size_t size) {
+        if(allocBudget == 0) {
+                throw std::bad_alloc();
+        }
+        if(allocBudget > 0) {
+                allocBudget--;
+        }
+        if(void* p = std::malloc(size)) {
+                return p;
+        }
+        throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept {
+        std::free(p);
+}
+
+struct Failure {}; // 移动/拷贝失败时抛出
+
+struct Cheap { // 移动不抛出异常，只会因分配节点失败
+        int v;
+        Cheap(int x): v(x) {}
+};
+
+struct Copyable { // 移动构造可能抛出，pop_all()取出的是副本
+        static int budget;
+        int v;
+        Copyable(int x): v(x) {}
+        Copyable(const Copyable& other): v(other.v) {
+                spend();
+        }
+        Copyable(Copyable&& other): v(other.v) {
+                spend();
+        }
+        Copyable& operator=(const Copyable&) = default;
+        static void spend() {
+                if(budget == 0) {
+                        throw Failure();
+                }
+                if(budget > 0) {
+                        budget--;
+                }
+        }
+};
+int Copyable::budget = -1;
+
+struct MoveOnly { // 只能移动，且移动可能抛出
+        static int budget;
+        int v;
+        MoveOnly(int x): v(x) {}
+        MoveOnly(const MoveOnly&) = delete;
+        MoveOnly(MoveOnly&& other): v(other.v) {
+                if(budget == 0) {
+                        throw Failure();
+                }
+                if(budget > 0) {
+                        budget--;
+                }
+        }
+        MoveOnly& operator=(MoveOnly&& other) noexcept {
+                v = other.v;
+                return *this;
+        }
+};
+int MoveOnly::budget = -1;
+
+template<typename T>
+void checkSequence(const LinkedList<T>& list, int first, int count) { // 检查list为first, first+1, ...共count个
+        assert(static_cast<int>(list.size()) == count);
+        for(const T& item : list) {
+                assert(item.v == first++);
+        }
+}
+
+int main() {
+        { // 分配第4个节点失败，已移入链表的元素移回队列
+                MPSCQueue<Cheap> q;
+                for(int i = 0; i < 5; i++) {
+                        q.emplace_back(i);
+                }
+                allocBudget = 3;
+                try {
+                        q.pop_all();
+                        assert(false);
+                } catch(const std::bad_alloc&) {}
+                allocBudget = -1;
+                checkSequence(q.pop_all(), 0, 5);
+                assert(q.empty());
+        }
+        { // 第3次拷贝失败，队列中的元素没有变化
+                MPSCQueue<Copyable> q;
+                for(int i = 0; i < 5; i++) {
+                        q.emplace_back(i);
+                }
+                Copyable::budget = 2;
+                try {
+                        q.pop_all();
+                        assert(false);
+                } catch(const Failure&) {}
+                Copyable::budget = -1;
+                checkSequence(q.pop_all(), 0, 5);
+        }
+        { // 第3次移动失败，已移出的2个元素无法放回，其余留在队列中
+                MPSCQueue<MoveOnly> q;
+                for(int i = 0; i < 5; i++) {
+                        q.emplace_back(i);
+                }
+                MoveOnly::budget = 2;
+                try {
+                        q.pop_all();
+                        assert(false);
+                } catch(const Failure&) {}
+                MoveOnly::budget = -1;
+                checkSequence(q.pop_all(), 2, 3);
+        }
+        { // 栈：移动赋值不抛出异常，整批移回
+                ConcurrentStack<MoveOnly> s;
+                for(int i = 4; i >= 0; i--) {
+                        s.emplace_front(i);
+                }
+                MoveOnly::budget = 2;
+                try {
+                        s.pop_all();
+                        assert(false);
+                } catch(const Failure&) {}
+                MoveOnly::budget = -1;
+                checkSequence(s.pop_all(), 0, 5);
+        }
+        { // 失败的同时生产者仍在并发加入，元素不丢失也不重复
+                MPSCQueue<Cheap> q;
+                const int total = 20000;
+                std::thread producer([&] {
+                        for(int i = 0; i < total; i++) {
+                                q.emplace_back(i);
+                        }
+                });
+                int next = 0;
+                for(int round = 0; round < 2000 || next < total; round++) {
+                        allocBudget = round < 2000? round % 7: -1; // 之后不再失败，取完剩下的
+                        try {
+                                LinkedList<Cheap> batch = q.pop_all();
+                                allocBudget = -1;
+                                for(const Cheap& item : batch) {
+                                        assert(item.v == next++);
+                                }
+                        } catch(const std::bad_alloc&) {
+                                allocBudget = -1;
+                        }
+                }
+                producer.join();
+                assert(next == total && q.empty());
+        }
+        cout << "pop_all failure cases passed\n";
+        return 0;
+}
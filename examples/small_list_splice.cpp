@@ -0,0 +1,41 @@
+#include <cassert>
+#include <iostream>
+#include "../SmallLinkedList.hpp"
+using std::cout;
+// 两个SmallLinkedList的节点各在自己的缓冲区中，拼接与合并后不能引用对方的缓冲区
+template<typename List>
+void printList(const List& l) {
+        for(auto it = l.cbegin(); it != l.cend(); ++it) {
+                cout << *it << " ";
+        }
+        cout << "\n";
+}
+
+int main() {
+        SmallLinkedList<int, 4> ml = {1, 3, 5}; // mergedList
+        {
+                SmallLinkedList<int, 4> other = {2, 4, 6, 8, 10};
+                ml.merge(other);
+                assert(other.empty());
+        }
+        printList(ml);
+        assert(ml.size() == 8 && ml.front() == 1 && ml.back() == 10);
+
+        SmallLinkedList<int, 4> sl = {0}; // splicedList
+        {
+                SmallLinkedList<int, 4> other = {1, 2, 3, 4, 5};
+                sl.splice_after(sl.cbegin(), other, other.cbegin()); // 只移动2
+                sl.splice_after(sl.cbefore_begin(), other, other.cbefore_begin(), ++other.cbegin()); // 只移动1
+                sl.append(std::move(other));
+                assert(other.empty());
+        }
+        printList(sl);
+        assert(sl.size() == 6 && sl.front() == 1 && sl.back() == 5);
+        {
+                SmallLinkedList<int, 4> other = {6, 7};
+                sl.splice_after(sl.cbefore_begin(), other);
+        }
+        printList(sl);
+        assert(sl.size() == 8 && sl.front() == 6);
+        return 0;
+}